@@ -0,0 +1,77 @@
+#pragma once
+#ifndef BENCH_COMMON_HPP
+	#define BENCH_COMMON_HPP
+
+	#include <cstdio>
+	#include <string>
+	#include <utility>
+
+	#include "bench_timer.hpp"
+
+namespace bench_common
+{
+	// Runs benchmarks through utils::benchmark and records every result both
+	// human-readable on stdout and as one JSON object per line in the results
+	// file, so release-to-release numbers can be diffed by machine.
+	class bench_reporter
+	{
+	public:
+		using self_t = bench_reporter;
+
+	private:
+		std::FILE* m_results;
+
+	public:
+		explicit bench_reporter(const std::string& p_results_path) : m_results(std::fopen(p_results_path.c_str(), "w"))
+		{
+			if (m_results == nullptr)
+			{
+				std::fprintf(stderr, "bench_reporter: cannot open %s, results go to stdout only\n", p_results_path.c_str());
+			}
+		}
+
+		~bench_reporter()
+		{
+			if (m_results != nullptr)
+			{
+				std::fclose(m_results);
+			}
+		}
+
+		bench_reporter(const self_t&)			 = delete;
+		auto operator=(const self_t&) -> self_t& = delete;
+
+		// p_bytes_per_iteration, when non-zero, adds a throughput figure to
+		// the record (I/O and memory benchmarks).
+		template <typename callable_t> auto run(const std::string& p_name, callable_t&& p_callable, std::size_t p_bytes_per_iteration = 0) -> void
+		{
+			utils::benchmark bench(p_name);
+			const utils::benchmark_result result = bench.run(std::forward<callable_t>(p_callable));
+			utils::benchmark::print(result);
+			write_record(result, p_bytes_per_iteration);
+		}
+
+	private:
+		auto write_record(const utils::benchmark_result& p_result, std::size_t p_bytes_per_iteration) -> void
+		{
+			if (m_results == nullptr)
+			{
+				return;
+			}
+			std::fprintf(m_results,
+						 "{\"name\":\"%s\",\"median_ns\":%.1f,\"mad_ns\":%.1f,\"mean_ns\":%.1f,\"stddev_ns\":%.1f,\"min_ns\":%.1f,"
+						 "\"iterations\":%zu,\"repetitions\":%zu,\"rejected\":%zu",
+						 p_result.m_name.c_str(), p_result.m_median_ns, p_result.m_mad_ns, p_result.m_mean_ns, p_result.m_std_dev_ns,
+						 p_result.m_min_ns, p_result.m_iterations, p_result.m_repetitions, p_result.m_rejected);
+			if (p_bytes_per_iteration > 0 && p_result.m_median_ns > 0.0)
+			{
+				const double gib_per_s = (static_cast<double>(p_bytes_per_iteration) / p_result.m_median_ns) * (1e9 / (1024.0 * 1024.0 * 1024.0));
+				std::fprintf(m_results, ",\"bytes\":%zu,\"gib_per_s\":%.3f", p_bytes_per_iteration, gib_per_s);
+			}
+			std::fprintf(m_results, "}\n");
+			std::fflush(m_results);
+		}
+	};
+}	 // namespace bench_common
+
+#endif	  // BENCH_COMMON_HPP
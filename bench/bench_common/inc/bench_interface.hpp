@@ -0,0 +1,23 @@
+#pragma once
+#ifndef BENCH_INTERFACE_HPP
+	#define BENCH_INTERFACE_HPP
+
+	#include "bench_utils_arg_parser.hpp"
+	#include "bench_utils_cmemory.hpp"
+	#include "bench_utils_file.hpp"
+	#include "bench_utils_profiler.hpp"
+	#include "bench_utils_ranges.hpp"
+
+struct bench_api
+{
+	static auto run_all_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		bench_utils_ranges::run_all_benchmarks(p_reporter);
+		bench_utils_file::run_all_benchmarks(p_reporter);
+		bench_utils_cmemory::run_all_benchmarks(p_reporter);
+		bench_utils_profiler::run_all_benchmarks(p_reporter);
+		bench_utils_arg_parser::run_all_benchmarks(p_reporter);
+	}
+};
+
+#endif	  // BENCH_INTERFACE_HPP
@@ -0,0 +1,14 @@
+#pragma once
+#ifndef BENCH_UTILS_ARG_PARSER_HPP
+	#define BENCH_UTILS_ARG_PARSER_HPP
+
+	#include "bench_common.hpp"
+
+namespace bench_utils_arg_parser
+{
+	auto run_startup_benchmarks(bench_common::bench_reporter& p_reporter) -> void;
+
+	static inline auto run_all_benchmarks(bench_common::bench_reporter& p_reporter) -> void { run_startup_benchmarks(p_reporter); }
+}
+
+#endif // BENCH_UTILS_ARG_PARSER_HPP
@@ -0,0 +1,19 @@
+#pragma once
+#ifndef BENCH_UTILS_CMEMORY_HPP
+	#define BENCH_UTILS_CMEMORY_HPP
+
+	#include "bench_common.hpp"
+
+namespace bench_utils_cmemory
+{
+	auto run_copy_benchmarks(bench_common::bench_reporter& p_reporter) -> void;
+	auto run_set_benchmarks(bench_common::bench_reporter& p_reporter) -> void;
+
+	static inline auto run_all_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		run_copy_benchmarks(p_reporter);
+		run_set_benchmarks(p_reporter);
+	}
+}
+
+#endif // BENCH_UTILS_CMEMORY_HPP
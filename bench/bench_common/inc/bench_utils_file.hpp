@@ -0,0 +1,19 @@
+#pragma once
+#ifndef BENCH_UTILS_FILE_HPP
+	#define BENCH_UTILS_FILE_HPP
+
+	#include "bench_common.hpp"
+
+namespace bench_utils_file
+{
+	auto run_file_benchmarks(bench_common::bench_reporter& p_reporter) -> void;
+	auto run_file_view_benchmarks(bench_common::bench_reporter& p_reporter) -> void;
+
+	static inline auto run_all_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		run_file_benchmarks(p_reporter);
+		run_file_view_benchmarks(p_reporter);
+	}
+}
+
+#endif // BENCH_UTILS_FILE_HPP
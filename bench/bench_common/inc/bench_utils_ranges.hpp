@@ -0,0 +1,19 @@
+#pragma once
+#ifndef BENCH_UTILS_RANGES_HPP
+	#define BENCH_UTILS_RANGES_HPP
+
+	#include "bench_common.hpp"
+
+namespace bench_utils_ranges
+{
+	auto run_sort_benchmarks(bench_common::bench_reporter& p_reporter) -> void;
+	auto run_parallel_benchmarks(bench_common::bench_reporter& p_reporter) -> void;
+
+	static inline auto run_all_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		run_sort_benchmarks(p_reporter);
+		run_parallel_benchmarks(p_reporter);
+	}
+}
+
+#endif // BENCH_UTILS_RANGES_HPP
@@ -0,0 +1,39 @@
+#include "bench_utils_arg_parser.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arg_parser.hpp"
+
+namespace bench_utils_arg_parser
+{
+	auto run_startup_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		// Registration cost: what every invocation pays before parsing starts
+		p_reporter.run("arg_parser/register_20",
+					   []()
+					   {
+						   utils::arg_parser parser;
+						   for (int idx_for = 0; idx_for < 20; ++idx_for)
+						   {
+							   const std::string name = "--option" + std::to_string(idx_for);
+							   parser.add_arg<std::string>(name, "benchmark option");
+						   }
+						   utils::do_not_optimize(parser);
+					   });
+
+		// Register + parse a typical short command line
+		const std::vector<std::string> args = {"program", "--alpha", "value", "--count", "42", "--rate", "2.5"};
+		p_reporter.run("arg_parser/parse_small",
+					   [&args]()
+					   {
+						   utils::arg_parser parser;
+						   parser.add_arg<std::string>("--alpha", "alpha option");
+						   parser.add_arg<std::int32_t>("--count", "count option");
+						   parser.add_arg<double>("--rate", "rate option");
+						   auto result = parser.parse(args);
+						   utils::do_not_optimize(result.has_value());
+					   });
+	}
+}
@@ -0,0 +1,41 @@
+#include "bench_utils_cmemory.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include "cmemory.hpp"
+
+namespace bench_utils_cmemory
+{
+	namespace
+	{
+		enum : std::size_t
+		{
+			k_small_block = 4096,		// One page: short-copy dispatch cost dominates
+			k_large_block = 1 << 20		// 1 MiB: streaming bandwidth dominates
+		};
+	}
+
+	auto run_copy_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		std::vector<unsigned char> src(k_large_block, 0x5A);
+		std::vector<unsigned char> dst(k_large_block);
+
+		p_reporter.run("mem_copy/4K", [&]() { utils::do_not_optimize(utils::mem_copy(dst.data(), src.data(), k_small_block)); }, k_small_block);
+		p_reporter.run("memcpy/4K", [&]() { utils::do_not_optimize(std::memcpy(dst.data(), src.data(), k_small_block)); }, k_small_block);
+
+		p_reporter.run("mem_copy/1M", [&]() { utils::do_not_optimize(utils::mem_copy(dst.data(), src.data(), k_large_block)); }, k_large_block);
+		p_reporter.run("memcpy/1M", [&]() { utils::do_not_optimize(std::memcpy(dst.data(), src.data(), k_large_block)); }, k_large_block);
+	}
+
+	auto run_set_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		std::vector<unsigned char> dst(k_large_block);
+
+		p_reporter.run("mem_set/4K", [&]() { utils::do_not_optimize(utils::mem_set(dst.data(), 0x7F, k_small_block)); }, k_small_block);
+		p_reporter.run("memset/4K", [&]() { utils::do_not_optimize(std::memset(dst.data(), 0x7F, k_small_block)); }, k_small_block);
+
+		p_reporter.run("mem_set/1M", [&]() { utils::do_not_optimize(utils::mem_set(dst.data(), 0x7F, k_large_block)); }, k_large_block);
+		p_reporter.run("memset/1M", [&]() { utils::do_not_optimize(std::memset(dst.data(), 0x7F, k_large_block)); }, k_large_block);
+	}
+}
@@ -0,0 +1,75 @@
+#include "bench_utils_file.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "file.hpp"
+
+namespace bench_utils_file
+{
+	namespace
+	{
+		struct tier
+		{
+			const char* m_name;
+			std::size_t m_bytes;
+		};
+
+		// One representative size per mem_size tier the strategies branch on;
+		// the larger tiers are too slow to repeat at benchmark density.
+		const tier k_tiers[] = {
+			{"tiny", static_cast<std::size_t>(utils::mem_size::tiny)},
+			{"small", static_cast<std::size_t>(utils::mem_size::small)},
+			{"medium", static_cast<std::size_t>(utils::mem_size::medium)},
+		};
+
+		auto scratch_path(const char* p_tier_name) -> std::string { return std::string("/tmp/utils_bench_") + p_tier_name + ".bin"; }
+
+		auto write_scratch_file(const std::string& p_path, std::size_t p_bytes) -> void
+		{
+			std::vector<unsigned char> payload(p_bytes);
+			for (std::size_t idx_for = 0; idx_for < p_bytes; ++idx_for)
+			{
+				payload[idx_for] = static_cast<unsigned char>(idx_for);
+			}
+			std::FILE* out = std::fopen(p_path.c_str(), "wb");
+			std::fwrite(payload.data(), 1, payload.size(), out);
+			std::fclose(out);
+		}
+	}	 // namespace
+
+	auto run_file_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		for (const tier& entry : k_tiers)
+		{
+			const std::string path = scratch_path(entry.m_name);
+			write_scratch_file(path, entry.m_bytes);
+			std::vector<unsigned char> buffer(entry.m_bytes);
+
+			{
+				utils::file reader(path, utils::file::mode_t::read, false);
+				p_reporter.run(std::string("file_read/") + entry.m_name,
+							   [&reader, &buffer]()
+							   {
+								   reader.seek(0);
+								   auto result = reader.read(buffer.data(), buffer.size());
+								   utils::do_not_optimize(result.has_value());
+							   },
+							   entry.m_bytes);
+			}
+
+			p_reporter.run(std::string("file_write/") + entry.m_name,
+						   [&path, &buffer]()
+						   {
+							   utils::file writer(path, utils::file::mode_t::write | utils::file::mode_t::truncate, false);
+							   auto result = writer.write(buffer.data(), buffer.size());
+							   utils::do_not_optimize(result.has_value());
+						   },
+						   entry.m_bytes);
+
+			std::remove(path.c_str());
+		}
+	}
+}
@@ -0,0 +1,69 @@
+// Separate translation unit: file_view.hpp and file.hpp both define the
+// utils::mem_size tiers and cannot be included together.
+#include "bench_utils_file.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "file_view.hpp"
+
+namespace bench_utils_file
+{
+	namespace
+	{
+		struct view_tier
+		{
+			const char* m_name;
+			std::size_t m_bytes;
+		};
+
+		const view_tier k_view_tiers[] = {
+			{"tiny", static_cast<std::size_t>(utils::mem_size::tiny)},
+			{"small", static_cast<std::size_t>(utils::mem_size::small)},
+			{"medium", static_cast<std::size_t>(utils::mem_size::medium)},
+		};
+
+		auto view_scratch_path(const char* p_tier_name) -> std::string { return std::string("/tmp/utils_bench_view_") + p_tier_name + ".bin"; }
+
+		auto write_view_scratch_file(const std::string& p_path, std::size_t p_bytes) -> void
+		{
+			std::vector<unsigned char> payload(p_bytes);
+			for (std::size_t idx_for = 0; idx_for < p_bytes; ++idx_for)
+			{
+				payload[idx_for] = static_cast<unsigned char>(idx_for);
+			}
+			std::FILE* out = std::fopen(p_path.c_str(), "wb");
+			std::fwrite(payload.data(), 1, payload.size(), out);
+			std::fclose(out);
+		}
+	}	 // namespace
+
+	auto run_file_view_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		for (const view_tier& entry : k_view_tiers)
+		{
+			const std::string path = view_scratch_path(entry.m_name);
+			write_view_scratch_file(path, entry.m_bytes);
+
+			// Map + touch every page: measures the tier's advice strategy,
+			// not just the mmap call
+			p_reporter.run(std::string("file_view_read/") + entry.m_name,
+						   [&path]()
+						   {
+							   utils::file_view view(path);
+							   const std::uint8_t* data = view.data();
+							   std::size_t checksum		= 0;
+							   for (std::uintmax_t idx_for = 0; idx_for < view.size(); idx_for += 4096)
+							   {
+								   checksum += data[idx_for];
+							   }
+							   utils::do_not_optimize(checksum);
+						   },
+						   entry.m_bytes);
+
+			std::remove(path.c_str());
+		}
+	}
+}
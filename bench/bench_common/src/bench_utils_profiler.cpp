@@ -0,0 +1,35 @@
+#include "bench_utils_profiler.hpp"
+
+#include "profiler.hpp"
+
+namespace bench_utils_profiler
+{
+	auto run_scope_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		utils::profiler& prof = utils::profiler::get_instance("bench");
+
+		// Full recorder path: map lookup plus hierarchy bookkeeping per scope
+		p_reporter.run("profiler_scope/recorder",
+					   [&prof]()
+					   {
+						   utils::profiler_recorder recorder("bench_scope", "bench_utils_profiler.cpp", 1);
+						   prof.push_recorder(recorder);
+						   prof.pop_recorder(recorder);
+					   });
+		prof.clear();
+
+		// Event path: one begin/end pair into the thread-local buffer. The
+		// first emission registers the buffer, so pay that outside the
+		// measurement or calibration stops at one iteration.
+		prof.emit_event(utils::profiler::event_kind::begin, "bench_event", "bench_utils_profiler.cpp", 1);
+		prof.emit_event(utils::profiler::event_kind::end, "bench_event", "bench_utils_profiler.cpp", 1);
+		p_reporter.run("profiler_scope/event",
+					   [&prof]()
+					   {
+						   prof.emit_event(utils::profiler::event_kind::begin, "bench_event", "bench_utils_profiler.cpp", 1);
+						   prof.emit_event(utils::profiler::event_kind::end, "bench_event", "bench_utils_profiler.cpp", 1);
+					   });
+		prof.collect_events();
+		prof.clear();
+	}
+}
@@ -0,0 +1,99 @@
+#include "bench_utils_ranges.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "ranges.hpp"
+
+namespace bench_utils_ranges
+{
+	namespace
+	{
+		auto make_random_ints(std::size_t p_count) -> std::vector<std::int32_t>
+		{
+			// Fixed seed so release-to-release numbers compare the same work
+			std::mt19937 gen(42);
+			std::uniform_int_distribution<std::int32_t> dist(0, 1 << 30);
+			std::vector<std::int32_t> data(p_count);
+			for (auto& value : data)
+			{
+				value = dist(gen);
+			}
+			return data;
+		}
+	}	 // namespace
+
+	auto run_sort_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		const std::vector<std::int32_t> source = make_random_ints(65536);
+
+		p_reporter.run("ranges_sort/65536",
+					   [&source]()
+					   {
+						   std::vector<std::int32_t> data = source;
+						   ranges::sort(data.begin(), data.end(), std::less<std::int32_t>());
+						   utils::do_not_optimize(data.front());
+					   });
+
+		p_reporter.run("std_sort/65536",
+					   [&source]()
+					   {
+						   std::vector<std::int32_t> data = source;
+						   std::sort(data.begin(), data.end());
+						   utils::do_not_optimize(data.front());
+					   });
+
+		const std::vector<std::int32_t> big = make_random_ints(1 << 20);
+
+		p_reporter.run("par_sort/1M",
+					   [&big]()
+					   {
+						   std::vector<std::int32_t> data = big;
+						   ranges::par::sort(data.begin(), data.end(), std::less<std::int32_t>());
+						   utils::do_not_optimize(data.front());
+					   });
+	}
+
+	auto run_parallel_benchmarks(bench_common::bench_reporter& p_reporter) -> void
+	{
+		const std::size_t count = 1 << 20;
+		std::vector<double> input(count);
+		std::iota(input.begin(), input.end(), 0.0);
+		std::vector<double> output(count);
+
+		p_reporter.run("par_transform/1M",
+					   [&input, &output]()
+					   {
+						   ranges::par::transform(input.begin(), input.end(), output.begin(), [](double p_value) { return p_value * 1.5 + 2.0; });
+						   utils::do_not_optimize(output.back());
+					   },
+					   count * sizeof(double));
+
+		p_reporter.run("std_transform/1M",
+					   [&input, &output]()
+					   {
+						   std::transform(input.begin(), input.end(), output.begin(), [](double p_value) { return p_value * 1.5 + 2.0; });
+						   utils::do_not_optimize(output.back());
+					   },
+					   count * sizeof(double));
+
+		p_reporter.run("par_reduce/1M",
+					   [&input]()
+					   {
+						   const double sum = ranges::par::reduce(input.begin(), input.end(), 0.0, [](double p_lhs, double p_rhs) { return p_lhs + p_rhs; });
+						   utils::do_not_optimize(sum);
+					   },
+					   count * sizeof(double));
+
+		p_reporter.run("std_accumulate/1M",
+					   [&input]()
+					   {
+						   const double sum = std::accumulate(input.begin(), input.end(), 0.0);
+						   utils::do_not_optimize(sum);
+					   },
+					   count * sizeof(double));
+	}
+}
@@ -0,0 +1,9 @@
+#include "bench_interface.hpp"
+
+auto main(int p_argc, char** p_argv) -> int
+{
+	const std::string results_path = (p_argc > 1) ? p_argv[1] : "bench_results.jsonl";
+	bench_common::bench_reporter reporter(results_path);
+	bench_api::run_all_benchmarks(reporter);
+	return 0;
+}
@@ -2,6 +2,7 @@
 #ifndef ARG_PARSER_HPP
 	#define ARG_PARSER_HPP
 
+	#include <array>
 	#include <cctype>
 	#include <cstdint>
 	#include <cstdlib>
@@ -1003,6 +1004,629 @@ namespace utils
 		auto set_logger(std::shared_ptr<logger> p_logger) -> void { m_logger = p_logger; }
 	};
 
+	enum class view_parse_error : std::uint8_t
+	{
+		none,
+		unknown_argument,
+		missing_value,
+		invalid_integer,
+		invalid_float,
+		invalid_boolean,
+		missing_required
+	};
+
+	namespace arg_detail
+	{
+		// Token converters shared by the view and static parsers. Values always
+		// terminate their argv token, so data() is NUL-terminated at the right
+		// place for strtoll/strtod.
+		inline auto parse_int_token(std::string_view p_value, std::int64_t& p_out) -> bool
+		{
+			char* end_ptr  = nullptr;
+			const auto val = std::strtoll(p_value.data(), &end_ptr, 10);
+			if (end_ptr == p_value.data() || end_ptr != p_value.data() + p_value.size())
+			{
+				return false;
+			}
+			p_out = val;
+			return true;
+		}
+
+		inline auto parse_float_token(std::string_view p_value, double& p_out) -> bool
+		{
+			char* end_ptr  = nullptr;
+			const auto val = std::strtod(p_value.data(), &end_ptr);
+			if (end_ptr == p_value.data() || end_ptr != p_value.data() + p_value.size())
+			{
+				return false;
+			}
+			p_out = val;
+			return true;
+		}
+
+		inline auto parse_bool_token(std::string_view p_value, bool p_has_value, bool& p_out) -> bool
+		{
+			if (!p_has_value || p_value == "true" || p_value == "1" || p_value == "yes")
+			{
+				p_out = true;
+				return true;
+			}
+			if (p_value == "false" || p_value == "0" || p_value == "no")
+			{
+				p_out = false;
+				return true;
+			}
+			return false;
+		}
+	}	 // namespace arg_detail
+
+	// Zero-allocation companion to arg_parser for hot startup paths: entries
+	// live in a flat table kept sorted by long name, tokens stay string_views
+	// into argv, and values land in typed fields instead of a variant. The
+	// table may grow during registration, but parse() itself never allocates.
+	// Registered names and parsed argv must outlive the parser.
+	class arg_view_parser
+	{
+	public:
+		using self_t = arg_view_parser;
+
+		struct parse_error
+		{
+			view_parse_error code;
+			std::string_view arg;
+
+			parse_error() : code(view_parse_error::none) {}
+
+			parse_error(view_parse_error p_code, std::string_view p_arg) : code(p_code), arg(p_arg) {}
+		};
+
+		using result_t = expected<bool, parse_error>;
+
+	private:
+		struct view_entry
+		{
+			std::string_view long_name;
+			std::string_view short_name;
+			std::string_view string_value;
+			std::string_view default_string;
+			std::int64_t int_value;
+			std::int64_t default_int;
+			double float_value;
+			double default_float;
+			arg_type type;
+			bool bool_value;
+			bool default_bool;
+			bool required;
+			bool was_set;
+
+			view_entry()
+				: int_value(0), default_int(0), float_value(0.0), default_float(0.0), type(arg_type::string_val), bool_value(false), default_bool(false),
+				  required(false), was_set(false)
+			{
+			}
+		};
+
+		std::vector<view_entry> m_entries;
+		bool m_help_requested;
+
+	public:
+		arg_view_parser() : m_help_requested(false) {}
+
+		auto reserve(std::size_t p_count) -> void { m_entries.reserve(p_count); }
+
+		auto add_string(std::string_view p_long_name, std::string_view p_short_name = {}, std::string_view p_default = {}, bool p_required = false)
+			-> self_t&
+		{
+			view_entry& entry	 = add_entry(p_long_name, p_short_name, arg_type::string_val, p_required);
+			entry.default_string = p_default;
+			return *this;
+		}
+
+		auto add_int(std::string_view p_long_name, std::string_view p_short_name = {}, std::int64_t p_default = 0, bool p_required = false) -> self_t&
+		{
+			view_entry& entry = add_entry(p_long_name, p_short_name, arg_type::integer_val, p_required);
+			entry.default_int = p_default;
+			return *this;
+		}
+
+		auto add_float(std::string_view p_long_name, std::string_view p_short_name = {}, double p_default = 0.0, bool p_required = false) -> self_t&
+		{
+			view_entry& entry	= add_entry(p_long_name, p_short_name, arg_type::float_val, p_required);
+			entry.default_float = p_default;
+			return *this;
+		}
+
+		auto add_bool(std::string_view p_long_name, std::string_view p_short_name = {}, bool p_default = false, bool p_required = false) -> self_t&
+		{
+			view_entry& entry  = add_entry(p_long_name, p_short_name, arg_type::boolean_val, p_required);
+			entry.default_bool = p_default;
+			return *this;
+		}
+
+		auto add_flag(std::string_view p_long_name, std::string_view p_short_name = {}) -> self_t&
+		{
+			add_entry(p_long_name, p_short_name, arg_type::flag_val, false);
+			return *this;
+		}
+
+		auto parse(std::int32_t p_argc, const char* const* p_argv) -> result_t
+		{
+			for (auto& entry : m_entries)
+			{
+				entry.string_value = entry.default_string;
+				entry.int_value	   = entry.default_int;
+				entry.float_value  = entry.default_float;
+				entry.bool_value   = entry.default_bool;
+				entry.was_set	   = false;
+			}
+			m_help_requested = false;
+
+			for (std::int32_t idx_for = 1; idx_for < p_argc; ++idx_for)
+			{
+				const std::string_view token(p_argv[idx_for]);
+				if (token.empty())
+				{
+					continue;
+				}
+				if (token == "-h" || token == "--help")
+				{
+					m_help_requested = true;
+					continue;
+				}
+
+				std::string_view name = token;
+				std::string_view value;
+				bool has_value	   = false;
+				const auto eq_pos  = token.find('=');
+				if (eq_pos != std::string_view::npos)
+				{
+					name	  = token.substr(0, eq_pos);
+					value	  = token.substr(eq_pos + 1);
+					has_value = true;
+				}
+
+				view_entry* entry = find_entry(name);
+				if (entry == nullptr)
+				{
+					return make_unexpected(parse_error(view_parse_error::unknown_argument, name));
+				}
+				entry->was_set = true;
+
+				if (entry->type == arg_type::flag_val)
+				{
+					entry->bool_value = true;
+					continue;
+				}
+
+				if (!has_value && idx_for + 1 < p_argc)
+				{
+					const std::string_view next(p_argv[idx_for + 1]);
+					if (!next.empty() && next[0] != '-')
+					{
+						value	  = next;
+						has_value = true;
+						++idx_for;
+					}
+				}
+
+				if (!has_value && entry->type != arg_type::boolean_val)
+				{
+					return make_unexpected(parse_error(view_parse_error::missing_value, name));
+				}
+
+				auto result = parse_value(*entry, name, value, has_value);
+				if (!result.has_value())
+				{
+					return result;
+				}
+			}
+
+			for (const auto& entry : m_entries)
+			{
+				if (entry.required && !entry.was_set)
+				{
+					return make_unexpected(parse_error(view_parse_error::missing_required, entry.long_name));
+				}
+			}
+
+			return true;
+		}
+
+		auto get_string(std::string_view p_name) const -> std::string_view
+		{
+			const view_entry* entry = find_entry(p_name);
+			return (entry != nullptr) ? entry->string_value : std::string_view();
+		}
+
+		auto get_int(std::string_view p_name) const -> std::int64_t
+		{
+			const view_entry* entry = find_entry(p_name);
+			return (entry != nullptr) ? entry->int_value : 0;
+		}
+
+		auto get_float(std::string_view p_name) const -> double
+		{
+			const view_entry* entry = find_entry(p_name);
+			return (entry != nullptr) ? entry->float_value : 0.0;
+		}
+
+		auto get_bool(std::string_view p_name) const -> bool
+		{
+			const view_entry* entry = find_entry(p_name);
+			return entry != nullptr && entry->bool_value;
+		}
+
+		auto was_set(std::string_view p_name) const -> bool
+		{
+			const view_entry* entry = find_entry(p_name);
+			return entry != nullptr && entry->was_set;
+		}
+
+		auto is_help_requested() const -> bool { return m_help_requested; }
+
+		// Cold path: renders a parse_error into text, the only place this
+		// class allocates after registration
+		static auto format_error(const parse_error& p_error) -> std::string
+		{
+			switch (p_error.code)
+			{
+			case view_parse_error::unknown_argument:
+				return std::format("Unknown argument: {}", p_error.arg);
+			case view_parse_error::missing_value:
+				return std::format("Argument {} requires a value", p_error.arg);
+			case view_parse_error::invalid_integer:
+				return std::format("Invalid integer value for {}", p_error.arg);
+			case view_parse_error::invalid_float:
+				return std::format("Invalid float value for {}", p_error.arg);
+			case view_parse_error::invalid_boolean:
+				return std::format("Invalid boolean value for {}", p_error.arg);
+			case view_parse_error::missing_required:
+				return std::format("Required argument missing: {}", p_error.arg);
+			default:
+				return std::string();
+			}
+		}
+
+	private:
+		auto add_entry(std::string_view p_long_name, std::string_view p_short_name, arg_type p_type, bool p_required) -> view_entry&
+		{
+			view_entry entry;
+			entry.long_name	 = p_long_name;
+			entry.short_name = p_short_name;
+			entry.type		 = p_type;
+			entry.required	 = p_required;
+
+			// Sorted insertion keeps find_entry a branch-free binary search
+			auto position = ranges::lower_bound(m_entries, entry, [](const view_entry& p_lhs, const view_entry& p_rhs) { return p_lhs.long_name < p_rhs.long_name; });
+			return *m_entries.insert(position, entry);
+		}
+
+		auto find_entry(std::string_view p_name) -> view_entry*
+		{
+			return const_cast<view_entry*>(static_cast<const self_t*>(this)->find_entry(p_name));
+		}
+
+		auto find_entry(std::string_view p_name) const -> const view_entry*
+		{
+			auto position = ranges::lower_bound(m_entries, p_name, [](const view_entry& p_entry, std::string_view p_value) { return p_entry.long_name < p_value; });
+			if (position != m_entries.end() && position->long_name == p_name)
+			{
+				return &*position;
+			}
+			for (const auto& entry : m_entries)
+			{
+				if (entry.short_name == p_name)
+				{
+					return &entry;
+				}
+			}
+			return nullptr;
+		}
+
+		auto parse_value(view_entry& p_entry, std::string_view p_name, std::string_view p_value, bool p_has_value) -> result_t
+		{
+			switch (p_entry.type)
+			{
+			case arg_type::integer_val:
+				if (!arg_detail::parse_int_token(p_value, p_entry.int_value))
+				{
+					return make_unexpected(parse_error(view_parse_error::invalid_integer, p_name));
+				}
+				break;
+			case arg_type::float_val:
+				if (!arg_detail::parse_float_token(p_value, p_entry.float_value))
+				{
+					return make_unexpected(parse_error(view_parse_error::invalid_float, p_name));
+				}
+				break;
+			case arg_type::boolean_val:
+				if (!arg_detail::parse_bool_token(p_value, p_has_value, p_entry.bool_value))
+				{
+					return make_unexpected(parse_error(view_parse_error::invalid_boolean, p_name));
+				}
+				break;
+			case arg_type::string_val:
+				p_entry.string_value = p_value;
+				break;
+			default:
+				break;
+			}
+			return true;
+		}
+	};
+
+	// One row of a compile-time argument schema; build tables with the
+	// make_*_arg helpers so only the relevant default field is spelled out
+	struct arg_spec
+	{
+		const char* long_name;
+		const char* short_name;
+		arg_type type;
+		bool required;
+		const char* default_string;
+		std::int64_t default_int;
+		double default_float;
+		bool default_bool;
+	};
+
+	constexpr auto make_string_arg(const char* p_long_name, const char* p_short_name = "", const char* p_default = "", bool p_required = false) -> arg_spec
+	{
+		return arg_spec{p_long_name, p_short_name, arg_type::string_val, p_required, p_default, 0, 0.0, false};
+	}
+
+	constexpr auto make_int_arg(const char* p_long_name, const char* p_short_name = "", std::int64_t p_default = 0, bool p_required = false) -> arg_spec
+	{
+		return arg_spec{p_long_name, p_short_name, arg_type::integer_val, p_required, "", p_default, 0.0, false};
+	}
+
+	constexpr auto make_float_arg(const char* p_long_name, const char* p_short_name = "", double p_default = 0.0, bool p_required = false) -> arg_spec
+	{
+		return arg_spec{p_long_name, p_short_name, arg_type::float_val, p_required, "", 0, p_default, false};
+	}
+
+	constexpr auto make_bool_arg(const char* p_long_name, const char* p_short_name = "", bool p_default = false, bool p_required = false) -> arg_spec
+	{
+		return arg_spec{p_long_name, p_short_name, arg_type::boolean_val, p_required, "", 0, 0.0, p_default};
+	}
+
+	constexpr auto make_flag_arg(const char* p_long_name, const char* p_short_name = "") -> arg_spec
+	{
+		return arg_spec{p_long_name, p_short_name, arg_type::flag_val, false, "", 0, 0.0, false};
+	}
+
+	// Parser over a constexpr arg_spec table for tools whose flag set is fixed
+	// at build time: the schema lives in static storage, slots and the lookup
+	// index are std::arrays, so construction and parsing touch the heap not at
+	// all — no map, no shared_ptr, no string copies.
+	template <std::size_t count_n> class static_arg_parser
+	{
+	public:
+		using self_t	  = static_arg_parser;
+		using parse_error = arg_view_parser::parse_error;
+		using result_t	  = arg_view_parser::result_t;
+
+	private:
+		struct slot_t
+		{
+			std::string_view string_value;
+			std::int64_t int_value;
+			double float_value;
+			bool bool_value;
+			bool was_set;
+
+			slot_t() : int_value(0), float_value(0.0), bool_value(false), was_set(false) {}
+		};
+
+		const arg_spec* m_specs;
+		std::array<slot_t, count_n> m_slots;
+		std::array<std::uint16_t, count_n> m_order;
+		bool m_help_requested;
+
+	public:
+		explicit static_arg_parser(const arg_spec (&p_specs)[count_n]) : m_specs(p_specs), m_help_requested(false)
+		{
+			// Index sorted by long name once at construction (insertion sort,
+			// no allocation); lookups binary-search through it
+			for (std::size_t idx_for = 0; idx_for < count_n; ++idx_for)
+			{
+				m_order[idx_for] = static_cast<std::uint16_t>(idx_for);
+			}
+			for (std::size_t idx_for = 1; idx_for < count_n; ++idx_for)
+			{
+				const std::uint16_t key = m_order[idx_for];
+				std::size_t pos			= idx_for;
+				while (pos > 0 && std::strcmp(m_specs[m_order[pos - 1]].long_name, m_specs[key].long_name) > 0)
+				{
+					m_order[pos] = m_order[pos - 1];
+					--pos;
+				}
+				m_order[pos] = key;
+			}
+			reset_slots();
+		}
+
+		auto parse(std::int32_t p_argc, const char* const* p_argv) -> result_t
+		{
+			reset_slots();
+			m_help_requested = false;
+
+			for (std::int32_t idx_for = 1; idx_for < p_argc; ++idx_for)
+			{
+				const std::string_view token(p_argv[idx_for]);
+				if (token.empty())
+				{
+					continue;
+				}
+				if (token == "-h" || token == "--help")
+				{
+					m_help_requested = true;
+					continue;
+				}
+
+				std::string_view name = token;
+				std::string_view value;
+				bool has_value	  = false;
+				const auto eq_pos = token.find('=');
+				if (eq_pos != std::string_view::npos)
+				{
+					name	  = token.substr(0, eq_pos);
+					value	  = token.substr(eq_pos + 1);
+					has_value = true;
+				}
+
+				const std::size_t index = find_index(name);
+				if (index == count_n)
+				{
+					return make_unexpected(parse_error(view_parse_error::unknown_argument, name));
+				}
+				const arg_spec& spec = m_specs[index];
+				slot_t& slot		 = m_slots[index];
+				slot.was_set		 = true;
+
+				if (spec.type == arg_type::flag_val)
+				{
+					slot.bool_value = true;
+					continue;
+				}
+
+				if (!has_value && idx_for + 1 < p_argc)
+				{
+					const std::string_view next(p_argv[idx_for + 1]);
+					if (!next.empty() && next[0] != '-')
+					{
+						value	  = next;
+						has_value = true;
+						++idx_for;
+					}
+				}
+
+				if (!has_value && spec.type != arg_type::boolean_val)
+				{
+					return make_unexpected(parse_error(view_parse_error::missing_value, name));
+				}
+
+				switch (spec.type)
+				{
+				case arg_type::integer_val:
+					if (!arg_detail::parse_int_token(value, slot.int_value))
+					{
+						return make_unexpected(parse_error(view_parse_error::invalid_integer, name));
+					}
+					break;
+				case arg_type::float_val:
+					if (!arg_detail::parse_float_token(value, slot.float_value))
+					{
+						return make_unexpected(parse_error(view_parse_error::invalid_float, name));
+					}
+					break;
+				case arg_type::boolean_val:
+					if (!arg_detail::parse_bool_token(value, has_value, slot.bool_value))
+					{
+						return make_unexpected(parse_error(view_parse_error::invalid_boolean, name));
+					}
+					break;
+				case arg_type::string_val:
+					slot.string_value = value;
+					break;
+				default:
+					break;
+				}
+			}
+
+			for (std::size_t idx_for = 0; idx_for < count_n; ++idx_for)
+			{
+				if (m_specs[idx_for].required && !m_slots[idx_for].was_set)
+				{
+					return make_unexpected(parse_error(view_parse_error::missing_required, std::string_view(m_specs[idx_for].long_name)));
+				}
+			}
+
+			return true;
+		}
+
+		auto get_string(std::string_view p_name) const -> std::string_view
+		{
+			const std::size_t index = find_index(p_name);
+			return (index != count_n) ? m_slots[index].string_value : std::string_view();
+		}
+
+		auto get_int(std::string_view p_name) const -> std::int64_t
+		{
+			const std::size_t index = find_index(p_name);
+			return (index != count_n) ? m_slots[index].int_value : 0;
+		}
+
+		auto get_float(std::string_view p_name) const -> double
+		{
+			const std::size_t index = find_index(p_name);
+			return (index != count_n) ? m_slots[index].float_value : 0.0;
+		}
+
+		auto get_bool(std::string_view p_name) const -> bool
+		{
+			const std::size_t index = find_index(p_name);
+			return index != count_n && m_slots[index].bool_value;
+		}
+
+		auto was_set(std::string_view p_name) const -> bool
+		{
+			const std::size_t index = find_index(p_name);
+			return index != count_n && m_slots[index].was_set;
+		}
+
+		auto is_help_requested() const -> bool { return m_help_requested; }
+
+	private:
+		auto reset_slots() -> void
+		{
+			for (std::size_t idx_for = 0; idx_for < count_n; ++idx_for)
+			{
+				m_slots[idx_for].string_value = std::string_view(m_specs[idx_for].default_string);
+				m_slots[idx_for].int_value	  = m_specs[idx_for].default_int;
+				m_slots[idx_for].float_value  = m_specs[idx_for].default_float;
+				m_slots[idx_for].bool_value	  = m_specs[idx_for].default_bool;
+				m_slots[idx_for].was_set	  = false;
+			}
+		}
+
+		auto find_index(std::string_view p_name) const -> std::size_t
+		{
+			std::size_t low	 = 0;
+			std::size_t high = count_n;
+			while (low < high)
+			{
+				const std::size_t mid		= low + (high - low) / 2;
+				const std::string_view name = std::string_view(m_specs[m_order[mid]].long_name);
+				if (name < p_name)
+				{
+					low = mid + 1;
+				}
+				else if (p_name < name)
+				{
+					high = mid;
+				}
+				else
+				{
+					return m_order[mid];
+				}
+			}
+			for (std::size_t idx_for = 0; idx_for < count_n; ++idx_for)
+			{
+				if (std::string_view(m_specs[idx_for].short_name) == p_name)
+				{
+					return idx_for;
+				}
+			}
+			return count_n;
+		}
+	};
+
+	// Deduces the table size so call sites stay free of explicit counts
+	template <std::size_t count_n> auto make_static_arg_parser(const arg_spec (&p_specs)[count_n]) -> static_arg_parser<count_n>
+	{
+		return static_arg_parser<count_n>(p_specs);
+	}
+
 }	 // namespace utils
 
 #endif	  // ARG_PARSER_HPP
@@ -2,9 +2,16 @@
 #ifndef BENCH_TIMER_HPP
 	#define BENCH_TIMER_HPP
 
+	#include <algorithm>
 	#include <chrono>
+	#include <cmath>
+	#include <cstddef>
 	#include <cstdio>
 	#include <string>
+	#include <utility>
+	#include <vector>
+
+	#include "statistics.hpp"
 
 struct bench_timer
 {
@@ -56,4 +63,166 @@ public:
 	}
 };
 
+namespace utils
+{
+	// Keeps p_value observable so the optimizer cannot delete the computation
+	// that produced it.
+	template <typename type_t> inline auto do_not_optimize(const type_t& p_value) -> void
+	{
+	#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(p_value) : "memory");
+	#else
+		static_cast<void>(p_value);
+	#endif
+	}
+
+	// Forces pending writes to be considered visible; pairs with
+	// do_not_optimize around the measured call.
+	inline auto clobber_memory() -> void
+	{
+	#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" ::: "memory");
+	#endif
+	}
+
+	struct benchmark_result
+	{
+		std::string m_name;
+		std::size_t m_iterations   = 0;		// Calls per repetition
+		std::size_t m_repetitions  = 0;		// Repetitions kept after outlier rejection
+		std::size_t m_rejected	   = 0;		// Repetitions discarded as outliers
+		double m_median_ns		   = 0.0;	// Median time per call
+		double m_mad_ns			   = 0.0;	// Median absolute deviation per call
+		double m_mean_ns		   = 0.0;
+		double m_std_dev_ns		   = 0.0;
+		double m_min_ns			   = 0.0;
+	};
+
+	// Regression-grade measurement on top of bench_timer's stopwatch: warmup,
+	// iteration counts calibrated so one repetition is long enough to time,
+	// several repetitions with MAD-based outlier rejection, and aggregate
+	// stats computed through utils::averager.
+	class benchmark
+	{
+	public:
+		using self_t = benchmark;
+
+	private:
+		std::string m_name;
+		std::size_t m_repetitions = 15;
+		std::chrono::nanoseconds m_min_repetition_time{2000000};
+
+	public:
+		explicit benchmark(std::string p_name = "") : m_name(std::move(p_name)) {}
+
+		auto set_repetitions(std::size_t p_repetitions) -> void { m_repetitions = p_repetitions; }
+
+		auto set_min_repetition_time(std::chrono::nanoseconds p_time) -> void { m_min_repetition_time = p_time; }
+
+		template <typename callable_t> auto run(callable_t&& p_callable) -> benchmark_result
+		{
+			const std::size_t iterations = calibrate(p_callable);
+
+			std::vector<double> samples;
+			samples.reserve(m_repetitions);
+			for (std::size_t rep = 0; rep < m_repetitions; ++rep)
+			{
+				samples.push_back(time_batch(p_callable, iterations));
+			}
+
+			// Reject repetitions further than 3 scaled MADs from the median —
+			// robust against scheduler noise unlike a sigma cut
+			const double median = median_of(samples);
+			std::vector<double> deviations;
+			deviations.reserve(samples.size());
+			for (const double sample : samples)
+			{
+				deviations.push_back(std::fabs(sample - median));
+			}
+			const double mad	   = median_of(deviations);
+			const double threshold = 3.0 * 1.4826 * mad;
+
+			averager<double> stats;
+			std::vector<double> kept;
+			kept.reserve(samples.size());
+			for (const double sample : samples)
+			{
+				if (mad == 0.0 || std::fabs(sample - median) <= threshold)
+				{
+					kept.push_back(sample);
+					stats.add_sample(sample);
+				}
+			}
+
+			benchmark_result result;
+			result.m_name		 = m_name;
+			result.m_iterations	 = iterations;
+			result.m_repetitions = kept.size();
+			result.m_rejected	 = samples.size() - kept.size();
+			result.m_median_ns	 = median_of(kept);
+			deviations.clear();
+			for (const double sample : kept)
+			{
+				deviations.push_back(std::fabs(sample - result.m_median_ns));
+			}
+			result.m_mad_ns		= median_of(deviations);
+			result.m_mean_ns	= stats.get_avg().has_value() ? stats.get_avg().value() : 0.0;
+			result.m_std_dev_ns = stats.get_std_dev().has_value() ? stats.get_std_dev().value() : 0.0;
+			result.m_min_ns		= stats.get_min();
+			return result;
+		}
+
+		static auto print(const benchmark_result& p_result) -> void
+		{
+			printf("%s: median %.1fns +/- %.1fns (MAD), mean %.1fns, stddev %.1fns, min %.1fns [%zu reps x %zu iters, %zu rejected]\n",
+				   p_result.m_name.c_str(), p_result.m_median_ns, p_result.m_mad_ns, p_result.m_mean_ns, p_result.m_std_dev_ns, p_result.m_min_ns,
+				   p_result.m_repetitions, p_result.m_iterations, p_result.m_rejected);
+			fflush(stdout);
+		}
+
+	private:
+		// Doubles the iteration count until one batch reaches the minimum
+		// repetition time, warming caches and branch predictors on the way.
+		template <typename callable_t> auto calibrate(callable_t& p_callable) -> std::size_t
+		{
+			const double target_ns = static_cast<double>(m_min_repetition_time.count());
+			std::size_t iterations = 1;
+			while (iterations < (static_cast<std::size_t>(1) << 30))
+			{
+				const double batch_ns = time_batch(p_callable, iterations) * static_cast<double>(iterations);
+				if (batch_ns >= target_ns)
+				{
+					break;
+				}
+				iterations *= 2;
+			}
+			return iterations;
+		}
+
+		// Times p_iterations calls; returns nanoseconds per call
+		template <typename callable_t> static auto time_batch(callable_t& p_callable, std::size_t p_iterations) -> double
+		{
+			const auto start = std::chrono::steady_clock::now();
+			for (std::size_t idx_for = 0; idx_for < p_iterations; ++idx_for)
+			{
+				p_callable();
+				clobber_memory();
+			}
+			const auto elapsed = std::chrono::steady_clock::now() - start;
+			return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / static_cast<double>(p_iterations);
+		}
+
+		static auto median_of(std::vector<double> p_samples) -> double
+		{
+			if (p_samples.empty())
+			{
+				return 0.0;
+			}
+			std::sort(p_samples.begin(), p_samples.end());
+			const std::size_t mid = p_samples.size() / 2;
+			return (p_samples.size() % 2 == 0) ? (p_samples[mid - 1] + p_samples[mid]) / 2.0 : p_samples[mid];
+		}
+	};
+}	 // namespace utils
+
 #endif	  // BENCH_TIMER_HPP
@@ -7,11 +7,18 @@
 	#include <cstdint>
 	#include <cstring>
 	#include <memory>
+	#include <mutex>
+	#include <new>
 	#include <type_traits>
 	#include <utility>
+	#include <vector>
 
 	#include "utils_macros.hpp"
 
+	#if defined(__AVX2__) || defined(__SSE2__)
+		#include <immintrin.h>
+	#endif
+
 	#if !MACRO_CXX14_ENABLED
 namespace std
 {
@@ -83,6 +90,216 @@ namespace utils
 		return std::memcmp(p_lhs, p_rhs, p_size);
 	}
 
+	/**
+	 * @brief Find first occurrence of a byte value
+	 * @return index of the byte, or p_size if not found
+	 */
+	inline auto mem_find(const void* p_data, std::size_t p_size, std::uint8_t p_value) -> std::size_t
+	{
+		const void* hit = std::memchr(p_data, static_cast<std::int32_t>(p_value), p_size);
+		return (hit != nullptr) ? static_cast<std::size_t>(static_cast<const std::uint8_t*>(hit) - static_cast<const std::uint8_t*>(p_data)) : p_size;
+	}
+
+	namespace detail
+	{
+		inline auto find_any_scalar(const std::uint8_t* p_data, std::size_t p_size, const std::uint8_t* p_set, std::size_t p_set_size) -> std::size_t
+		{
+			bool table[256] = {};
+			for (std::size_t idx_for = 0U; idx_for < p_set_size; ++idx_for)
+			{
+				table[p_set[idx_for]] = true;
+			}
+
+			for (std::size_t idx_for = 0U; idx_for < p_size; ++idx_for)
+			{
+				if (table[p_data[idx_for]])
+				{
+					return idx_for;
+				}
+			}
+			return p_size;
+		}
+	}	 // namespace detail
+
+	/**
+	 * @brief Find first occurrence of any byte from a set
+	 * @return index of the first matching byte, or p_size if none match
+	 */
+	inline auto mem_find_any(const void* p_data, std::size_t p_size, const std::uint8_t* p_set, std::size_t p_set_size) -> std::size_t
+	{
+		const std::uint8_t* data = static_cast<const std::uint8_t*>(p_data);
+		if (p_set_size == 0U)
+		{
+			return p_size;
+		}
+
+#if defined(__AVX2__)
+		std::size_t idx = 0U;
+		for (; idx + 32U <= p_size; idx += 32U)
+		{
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + idx));
+			__m256i hits		= _mm256_setzero_si256();
+			for (std::size_t needle = 0U; needle < p_set_size; ++needle)
+			{
+				hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, _mm256_set1_epi8(static_cast<char>(p_set[needle]))));
+			}
+			const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(hits));
+			if (mask != 0U)
+			{
+				return idx + static_cast<std::size_t>(__builtin_ctz(mask));
+			}
+		}
+		const std::size_t tail = detail::find_any_scalar(data + idx, p_size - idx, p_set, p_set_size);
+		return (tail < p_size - idx) ? idx + tail : p_size;
+#elif defined(__SSE2__)
+		std::size_t idx = 0U;
+		for (; idx + 16U <= p_size; idx += 16U)
+		{
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + idx));
+			__m128i hits		= _mm_setzero_si128();
+			for (std::size_t needle = 0U; needle < p_set_size; ++needle)
+			{
+				hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, _mm_set1_epi8(static_cast<char>(p_set[needle]))));
+			}
+			const std::uint32_t mask = static_cast<std::uint32_t>(_mm_movemask_epi8(hits));
+			if (mask != 0U)
+			{
+				return idx + static_cast<std::size_t>(__builtin_ctz(mask));
+			}
+		}
+		const std::size_t tail = detail::find_any_scalar(data + idx, p_size - idx, p_set, p_set_size);
+		return (tail < p_size - idx) ? idx + tail : p_size;
+#else
+		return detail::find_any_scalar(data, p_size, p_set, p_set_size);
+#endif
+	}
+
+	/**
+	 * @brief Test two memory regions for byte equality
+	 *
+	 * Faster than mem_compare when ordering is not needed: wide compares bail
+	 * out on the first mismatching lane without computing a sign.
+	 */
+	inline auto mem_equal(const void* p_lhs, const void* p_rhs, std::size_t p_size) -> bool
+	{
+#if defined(__AVX2__)
+		const std::uint8_t* lhs = static_cast<const std::uint8_t*>(p_lhs);
+		const std::uint8_t* rhs = static_cast<const std::uint8_t*>(p_rhs);
+		std::size_t idx			= 0U;
+		for (; idx + 32U <= p_size; idx += 32U)
+		{
+			const __m256i left	= _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + idx));
+			const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + idx));
+			if (static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right))) != 0xFFFFFFFFU)
+			{
+				return false;
+			}
+		}
+		return std::memcmp(lhs + idx, rhs + idx, p_size - idx) == 0;
+#elif defined(__SSE2__)
+		const std::uint8_t* lhs = static_cast<const std::uint8_t*>(p_lhs);
+		const std::uint8_t* rhs = static_cast<const std::uint8_t*>(p_rhs);
+		std::size_t idx			= 0U;
+		for (; idx + 16U <= p_size; idx += 16U)
+		{
+			const __m128i left	= _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + idx));
+			const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + idx));
+			if (static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(left, right))) != 0xFFFFU)
+			{
+				return false;
+			}
+		}
+		return std::memcmp(lhs + idx, rhs + idx, p_size - idx) == 0;
+#else
+		return std::memcmp(p_lhs, p_rhs, p_size) == 0;
+#endif
+	}
+
+	/**
+	 * @brief Find first occurrence of a byte sequence
+	 *
+	 * Filters candidate positions by matching the first and last needle byte
+	 * as a pair with wide compares, then verifies the middle, so the full
+	 * comparison only runs at positions that already match at both ends.
+	 * @return index of the match, or p_size if not found
+	 */
+	inline auto mem_search(const void* p_haystack, std::size_t p_size, const void* p_needle, std::size_t p_needle_size) -> std::size_t
+	{
+		const std::uint8_t* haystack = static_cast<const std::uint8_t*>(p_haystack);
+		const std::uint8_t* needle	 = static_cast<const std::uint8_t*>(p_needle);
+		if (p_needle_size == 0U)
+		{
+			return 0U;
+		}
+		if (p_needle_size > p_size)
+		{
+			return p_size;
+		}
+		if (p_needle_size == 1U)
+		{
+			return mem_find(haystack, p_size, needle[0]);
+		}
+
+		const std::size_t last = p_needle_size - 1U;
+		const std::size_t span = p_size - p_needle_size + 1U;
+		std::size_t idx		   = 0U;
+
+#if defined(__AVX2__)
+		const __m256i first_wide = _mm256_set1_epi8(static_cast<char>(needle[0]));
+		const __m256i last_wide	 = _mm256_set1_epi8(static_cast<char>(needle[last]));
+		for (; idx + 32U <= span; idx += 32U)
+		{
+			const __m256i eq_first = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + idx)), first_wide);
+			const __m256i eq_last  = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(haystack + idx + last)), last_wide);
+			std::uint32_t mask	   = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(eq_first, eq_last)));
+			while (mask != 0U)
+			{
+				const std::size_t pos = idx + static_cast<std::size_t>(__builtin_ctz(mask));
+				if (std::memcmp(haystack + pos + 1U, needle + 1U, p_needle_size - 2U) == 0)
+				{
+					return pos;
+				}
+				mask &= mask - 1U;
+			}
+		}
+#elif defined(__SSE2__)
+		const __m128i first_wide = _mm_set1_epi8(static_cast<char>(needle[0]));
+		const __m128i last_wide	 = _mm_set1_epi8(static_cast<char>(needle[last]));
+		for (; idx + 16U <= span; idx += 16U)
+		{
+			const __m128i eq_first = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + idx)), first_wide);
+			const __m128i eq_last  = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(haystack + idx + last)), last_wide);
+			std::uint32_t mask	   = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(eq_first, eq_last)));
+			while (mask != 0U)
+			{
+				const std::size_t pos = idx + static_cast<std::size_t>(__builtin_ctz(mask));
+				if (std::memcmp(haystack + pos + 1U, needle + 1U, p_needle_size - 2U) == 0)
+				{
+					return pos;
+				}
+				mask &= mask - 1U;
+			}
+		}
+#endif
+
+		while (idx < span)
+		{
+			const std::size_t hit = mem_find(haystack + idx, span - idx, needle[0]);
+			if (hit == span - idx)
+			{
+				return p_size;
+			}
+
+			idx += hit;
+			if (haystack[idx + last] == needle[last] && std::memcmp(haystack + idx + 1U, needle + 1U, p_needle_size - 2U) == 0)
+			{
+				return idx;
+			}
+			++idx;
+		}
+		return p_size;
+	}
+
 	namespace cmemory
 	{
 		/**
@@ -518,6 +735,462 @@ namespace utils
 			auto get_available() const noexcept -> std::size_t { return pool_size - m_allocated; }
 		};
 
+		/**
+		 * @brief Typed object pool with thread-local free lists
+		 *
+		 * allocate()/deallocate() normally touch only the calling thread's cache;
+		 * the shared slab list is locked only to refill or drain a whole batch, so
+		 * steady-state churn on one thread costs a single pointer pop. Slabs are
+		 * retained for the lifetime of the pool.
+		 */
+		template <typename type_t, std::size_t batch_size = 32U> class object_pool
+		{
+		public:
+			using self_t	 = object_pool;
+			using value_type = type_t;
+
+		private:
+			union node
+			{
+				node* next;
+				alignas(alignof(type_t)) unsigned char storage[sizeof(type_t)];
+			};
+
+			struct local_cache
+			{
+				object_pool* pool;
+				node* head;
+				std::size_t count;
+
+				local_cache() : pool(nullptr), head(nullptr), count(0U) {}
+
+				~local_cache()
+				{
+					if (pool != nullptr)
+					{
+						pool->drain(head);
+					}
+				}
+			};
+
+			std::mutex m_mutex;
+			node* m_free_list;
+			std::vector<std::unique_ptr<node[]> > m_slabs;
+
+		public:
+			/**
+			 * @brief Default destructor
+			 */
+			~object_pool() = default;
+
+			/**
+			 * @brief Default constructor
+			 */
+			object_pool() : m_free_list(nullptr) {}
+
+			object_pool(const self_t&)				 = delete;
+			auto operator=(const self_t&) -> self_t& = delete;
+			object_pool(self_t&&)					 = delete;
+			auto operator=(self_t&&) -> self_t&		 = delete;
+
+		public:
+			/**
+			 * @brief Get the process-wide pool for this type
+			 *
+			 * Leaked intentionally so static-duration objects can still free
+			 * into the pool during program teardown regardless of destruction
+			 * order; the OS reclaims the slabs at exit.
+			 */
+			static auto instance() -> self_t&
+			{
+				static self_t* pool = new self_t();
+				return *pool;
+			}
+
+			/**
+			 * @brief Take raw storage for one object from the calling thread's cache
+			 */
+			auto allocate() -> type_t*
+			{
+				local_cache& cache = this_thread_cache();
+				if (cache.head == nullptr)
+				{
+					refill(cache);
+				}
+
+				node* entry = cache.head;
+				cache.head	= entry->next;
+				--cache.count;
+				return reinterpret_cast<type_t*>(entry->storage);
+			}
+
+			/**
+			 * @brief Return storage to the calling thread's cache
+			 */
+			auto deallocate(type_t* p_ptr) -> void
+			{
+				local_cache& cache = this_thread_cache();
+				node* entry		   = reinterpret_cast<node*>(p_ptr);
+				entry->next		   = cache.head;
+				cache.head		   = entry;
+				++cache.count;
+				if (cache.count >= batch_size * 2U)
+				{
+					spill(cache);
+				}
+			}
+
+			/**
+			 * @brief Allocate and construct an object in-place
+			 * @return pointer to constructed object
+			 */
+			template <typename... args_t> auto construct(args_t&&... p_args) -> type_t*
+			{
+				type_t* storage = allocate();
+				return new (storage) type_t(std::forward<args_t>(p_args)...);
+			}
+
+			/**
+			 * @brief Destroy an object and return its storage to the pool
+			 */
+			auto destroy(type_t* p_ptr) -> void
+			{
+				if (p_ptr == nullptr)
+				{
+					return;
+				}
+
+				p_ptr->~type_t();
+				deallocate(p_ptr);
+			}
+
+		private:
+			auto this_thread_cache() -> local_cache&
+			{
+				static thread_local local_cache t_cache;
+				if (t_cache.pool != this)
+				{
+					if (t_cache.pool != nullptr)
+					{
+						t_cache.pool->drain(t_cache.head);
+					}
+
+					t_cache.pool  = this;
+					t_cache.head  = nullptr;
+					t_cache.count = 0U;
+				}
+				return t_cache;
+			}
+
+			auto refill(local_cache& p_cache) -> void
+			{
+				std::lock_guard<std::mutex> guard(m_mutex);
+				if (m_free_list == nullptr)
+				{
+					grow();
+				}
+
+				while (p_cache.count < batch_size && m_free_list != nullptr)
+				{
+					node* entry	 = m_free_list;
+					m_free_list	 = entry->next;
+					entry->next	 = p_cache.head;
+					p_cache.head = entry;
+					++p_cache.count;
+				}
+			}
+
+			auto spill(local_cache& p_cache) -> void
+			{
+				node* batch_head = p_cache.head;
+				node* batch_tail = batch_head;
+				for (std::size_t idx_for = 1U; idx_for < batch_size; ++idx_for)
+				{
+					batch_tail = batch_tail->next;
+				}
+
+				p_cache.head = batch_tail->next;
+				p_cache.count -= batch_size;
+
+				std::lock_guard<std::mutex> guard(m_mutex);
+				batch_tail->next = m_free_list;
+				m_free_list		 = batch_head;
+			}
+
+			auto drain(node* p_head) -> void
+			{
+				if (p_head == nullptr)
+				{
+					return;
+				}
+
+				node* tail = p_head;
+				while (tail->next != nullptr)
+				{
+					tail = tail->next;
+				}
+
+				std::lock_guard<std::mutex> guard(m_mutex);
+				tail->next	= m_free_list;
+				m_free_list = p_head;
+			}
+
+			// Caller holds m_mutex
+			auto grow() -> void
+			{
+				const std::size_t slab_nodes = batch_size * 8U;
+				m_slabs.push_back(std::make_unique<node[]>(slab_nodes));
+				node* slab = m_slabs.back().get();
+				for (std::size_t idx_for = 0U; idx_for < slab_nodes; ++idx_for)
+				{
+					slab[idx_for].next = m_free_list;
+					m_free_list		   = &slab[idx_for];
+				}
+			}
+		};
+
+		/**
+		 * @brief Minimal C++11 allocator adapter over the per-type object_pool
+		 *
+		 * Single-object allocations go through the pool's thread-local cache;
+		 * array allocations fall back to operator new. Lets std::allocate_shared
+		 * place both the object and its control block in pooled storage.
+		 */
+		template <typename type_t, std::size_t batch_size = 32U> class pool_allocator
+		{
+		public:
+			using self_t	 = pool_allocator;
+			using value_type = type_t;
+
+			template <typename other_t> struct rebind
+			{
+				using other = pool_allocator<other_t, batch_size>;
+			};
+
+		public:
+			pool_allocator() noexcept = default;
+
+			template <typename other_t> pool_allocator(const pool_allocator<other_t, batch_size>& /*p_other*/) noexcept {}
+
+		public:
+			auto allocate(std::size_t p_count) -> type_t*
+			{
+				if (p_count == 1U)
+				{
+					return object_pool<type_t, batch_size>::instance().allocate();
+				}
+				return static_cast<type_t*>(::operator new(p_count * sizeof(type_t)));
+			}
+
+			auto deallocate(type_t* p_ptr, std::size_t p_count) -> void
+			{
+				if (p_count == 1U)
+				{
+					object_pool<type_t, batch_size>::instance().deallocate(p_ptr);
+					return;
+				}
+				::operator delete(p_ptr);
+			}
+
+			friend auto operator==(const self_t& /*p_lhs*/, const self_t& /*p_rhs*/) noexcept -> bool { return true; }
+
+			friend auto operator!=(const self_t& /*p_lhs*/, const self_t& /*p_rhs*/) noexcept -> bool { return false; }
+		};
+
+		/**
+		 * @brief Chunked bump allocator for short-lived allocations
+		 *
+		 * allocate() is a pointer bump into the current chunk; exhausted chunks are
+		 * kept and reused after reset(), so a warmed arena performs no heap calls.
+		 * Individual deallocation is intentionally absent — everything is released
+		 * at once via reset() or a scope guard.
+		 */
+		class arena
+		{
+		public:
+			using self_t = arena;
+
+			static constexpr std::size_t k_default_chunk_size = 64U * 1024U;
+
+		private:
+			struct chunk
+			{
+				std::unique_ptr<std::uint8_t[]> data;
+				std::size_t capacity;
+			};
+
+			std::vector<chunk> m_chunks;
+			std::size_t m_chunk_index;
+			std::size_t m_offset;
+			std::size_t m_chunk_size;
+
+		public:
+			/**
+			 * @brief RAII marker that rewinds the arena to its construction point
+			 */
+			class scope
+			{
+			public:
+				using self_t = scope;
+
+			private:
+				arena& m_arena;
+				std::size_t m_chunk_index;
+				std::size_t m_offset;
+
+			public:
+				~scope() { m_arena.rewind(m_chunk_index, m_offset); }
+
+				explicit scope(arena& p_arena) : m_arena(p_arena), m_chunk_index(p_arena.m_chunk_index), m_offset(p_arena.m_offset) {}
+
+				scope(const self_t&)					 = delete;
+				auto operator=(const self_t&) -> self_t& = delete;
+				scope(self_t&&)							 = delete;
+				auto operator=(self_t&&) -> self_t&		 = delete;
+			};
+
+		public:
+			/**
+			 * @brief Default destructor
+			 */
+			~arena() = default;
+
+			/**
+			 * @brief Construct arena with given chunk granularity
+			 */
+			explicit arena(std::size_t p_chunk_size = k_default_chunk_size) : m_chunk_index(0U), m_offset(0U), m_chunk_size(p_chunk_size) {}
+
+			arena(const self_t&)					 = delete;
+			auto operator=(const self_t&) -> self_t& = delete;
+			arena(self_t&&) noexcept				 = default;
+			auto operator=(self_t&&) noexcept -> self_t& = default;
+
+		public:
+			/**
+			 * @brief Allocate p_size bytes with the requested alignment
+			 * @return pointer to storage (never returns nullptr; grows on demand)
+			 */
+			auto allocate(std::size_t p_size, std::size_t p_alignment = alignof(std::max_align_t)) -> void*
+			{
+				for (;;)
+				{
+					if (m_chunk_index < m_chunks.size())
+					{
+						chunk& current			   = m_chunks[m_chunk_index];
+
+						// Align the absolute address, not the chunk-relative
+						// offset: chunk bases are only max_align_t-aligned, so
+						// over-aligned requests need the base folded in
+						const std::uintptr_t base  = reinterpret_cast<std::uintptr_t>(current.data.get());
+						const std::size_t aligned  = static_cast<std::size_t>(align_up(static_cast<std::size_t>(base) + m_offset, p_alignment) - base);
+						if (aligned + p_size <= current.capacity)
+						{
+							m_offset = aligned + p_size;
+							return current.data.get() + aligned;
+						}
+
+						++m_chunk_index;
+						m_offset = 0U;
+						continue;
+					}
+
+					const std::size_t capacity = std::max(m_chunk_size, p_size + p_alignment);
+					chunk fresh;
+					fresh.data	   = std::make_unique<std::uint8_t[]>(capacity);
+					fresh.capacity = capacity;
+					m_chunks.push_back(std::move(fresh));
+				}
+			}
+
+			/**
+			 * @brief Construct an object inside the arena (no individual destroy)
+			 * @return pointer to constructed object
+			 */
+			template <typename type_t, typename... args_t> auto construct(args_t&&... p_args) -> type_t*
+			{
+				void* storage = allocate(sizeof(type_t), alignof(type_t));
+				return new (storage) type_t(std::forward<args_t>(p_args)...);
+			}
+
+			/**
+			 * @brief Rewind to empty, keeping every chunk for reuse
+			 */
+			auto reset() noexcept -> void
+			{
+				m_chunk_index = 0U;
+				m_offset	  = 0U;
+			}
+
+			/**
+			 * @brief Release all chunks back to the heap
+			 */
+			auto release() noexcept -> void
+			{
+				m_chunks.clear();
+				reset();
+			}
+
+			/**
+			 * @brief Get total bytes held across chunks
+			 */
+			auto capacity() const noexcept -> std::size_t
+			{
+				std::size_t total = 0U;
+				for (const chunk& entry : m_chunks)
+				{
+					total += entry.capacity;
+				}
+				return total;
+			}
+
+		private:
+			auto rewind(std::size_t p_chunk_index, std::size_t p_offset) noexcept -> void
+			{
+				m_chunk_index = p_chunk_index;
+				m_offset	  = p_offset;
+			}
+		};
+
+		/**
+		 * @brief Minimal C++11 allocator adapter over an arena
+		 *
+		 * Plugs arena storage into standard containers; deallocate is a no-op, the
+		 * arena's reset()/scope reclaims the memory.
+		 */
+		template <typename type_t> class arena_allocator
+		{
+		public:
+			using self_t	 = arena_allocator;
+			using value_type = type_t;
+
+			template <typename other_t> struct rebind
+			{
+				using other = arena_allocator<other_t>;
+			};
+
+		private:
+			arena* m_arena;
+
+			template <typename other_t> friend class arena_allocator;
+
+		public:
+			explicit arena_allocator(arena& p_arena) noexcept : m_arena(&p_arena) {}
+
+			template <typename other_t> arena_allocator(const arena_allocator<other_t>& p_other) noexcept : m_arena(p_other.m_arena) {}
+
+		public:
+			auto allocate(std::size_t p_count) -> type_t*
+			{
+				return static_cast<type_t*>(m_arena->allocate(p_count * sizeof(type_t), alignof(type_t)));
+			}
+
+			auto deallocate(type_t* /*p_ptr*/, std::size_t /*p_count*/) noexcept -> void {}
+
+			friend auto operator==(const self_t& p_lhs, const self_t& p_rhs) noexcept -> bool { return p_lhs.m_arena == p_rhs.m_arena; }
+
+			friend auto operator!=(const self_t& p_lhs, const self_t& p_rhs) noexcept -> bool { return !(p_lhs == p_rhs); }
+		};
+
 		/**
 		 * @brief Minimal scoped pointer providing unique ownership
 		 *
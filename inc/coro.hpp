@@ -0,0 +1,504 @@
+#pragma once
+#ifndef CORO_HPP
+	#define CORO_HPP
+
+	#include "utils_macros.hpp"
+
+	#if MACRO_CXX20_ENABLED && defined(__cpp_impl_coroutine)
+
+		#include <condition_variable>
+		#include <coroutine>
+		#include <deque>
+		#include <exception>
+		#include <future>
+		#include <mutex>
+		#include <optional>
+		#include <string>
+		#include <utility>
+
+		#include "task_scheduler.hpp"
+		#include "utils_process.hpp"
+
+namespace utils
+{
+	template <typename value_t> class task;
+
+	namespace coro_detail
+	{
+		// Final suspend hands control straight back to whoever awaited the
+		// task (symmetric transfer), or to no one for a detached frame
+		struct promise_base
+		{
+			std::coroutine_handle<> m_continuation;
+			std::exception_ptr m_error;
+
+			struct final_awaiter
+			{
+				auto await_ready() const noexcept -> bool { return false; }
+
+				template <typename promise_t> auto await_suspend(std::coroutine_handle<promise_t> p_handle) const noexcept -> std::coroutine_handle<>
+				{
+					std::coroutine_handle<> continuation = p_handle.promise().m_continuation;
+					return continuation ? continuation : std::noop_coroutine();
+				}
+
+				auto await_resume() const noexcept -> void {}
+			};
+
+			auto initial_suspend() noexcept -> std::suspend_always { return {}; }
+
+			auto final_suspend() noexcept -> final_awaiter { return {}; }
+
+			auto unhandled_exception() noexcept -> void { m_error = std::current_exception(); }
+		};
+	}	 // namespace coro_detail
+
+	/**
+	 * @brief Lazy coroutine task
+	 *
+	 * The coroutine body does not start until the task is awaited; on
+	 * completion control transfers directly back to the awaiter without a
+	 * scheduler round trip. Exceptions thrown in the body rethrow from
+	 * co_await. Move-only; destroying a task destroys the frame.
+	 */
+	template <typename value_t> class task
+	{
+	public:
+		using self_t = task<value_t>;
+
+		struct promise_type : coro_detail::promise_base
+		{
+			std::optional<value_t> m_value;
+
+			auto get_return_object() -> self_t { return self_t(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+			template <typename arg_t> auto return_value(arg_t&& p_value) -> void { m_value.emplace(std::forward<arg_t>(p_value)); }
+		};
+
+	private:
+		std::coroutine_handle<promise_type> m_handle;
+
+		explicit task(std::coroutine_handle<promise_type> p_handle) : m_handle(p_handle) {}
+
+	public:
+		~task()
+		{
+			if (m_handle)
+			{
+				m_handle.destroy();
+			}
+		}
+
+		task() : m_handle(nullptr) {}
+
+		task(const self_t&)						 = delete;
+		auto operator=(const self_t&) -> self_t& = delete;
+
+		task(self_t&& p_other) noexcept : m_handle(std::exchange(p_other.m_handle, nullptr)) {}
+
+		auto operator=(self_t&& p_other) noexcept -> self_t&
+		{
+			if (this != &p_other)
+			{
+				if (m_handle)
+				{
+					m_handle.destroy();
+				}
+				m_handle = std::exchange(p_other.m_handle, nullptr);
+			}
+			return *this;
+		}
+
+		auto operator co_await() noexcept
+		{
+			struct awaiter
+			{
+				std::coroutine_handle<promise_type> m_handle;
+
+				auto await_ready() const noexcept -> bool { return false; }
+
+				auto await_suspend(std::coroutine_handle<> p_awaiting) noexcept -> std::coroutine_handle<>
+				{
+					m_handle.promise().m_continuation = p_awaiting;
+					return m_handle;
+				}
+
+				auto await_resume() -> value_t
+				{
+					if (m_handle.promise().m_error)
+					{
+						std::rethrow_exception(m_handle.promise().m_error);
+					}
+					return std::move(*m_handle.promise().m_value);
+				}
+			};
+
+			return awaiter{m_handle};
+		}
+	};
+
+	template <> class task<void>
+	{
+	public:
+		using self_t = task<void>;
+
+		struct promise_type : coro_detail::promise_base
+		{
+			auto get_return_object() -> self_t { return self_t(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+			auto return_void() noexcept -> void {}
+		};
+
+	private:
+		std::coroutine_handle<promise_type> m_handle;
+
+		explicit task(std::coroutine_handle<promise_type> p_handle) : m_handle(p_handle) {}
+
+	public:
+		~task()
+		{
+			if (m_handle)
+			{
+				m_handle.destroy();
+			}
+		}
+
+		task() : m_handle(nullptr) {}
+
+		task(const self_t&)						 = delete;
+		auto operator=(const self_t&) -> self_t& = delete;
+
+		task(self_t&& p_other) noexcept : m_handle(std::exchange(p_other.m_handle, nullptr)) {}
+
+		auto operator=(self_t&& p_other) noexcept -> self_t&
+		{
+			if (this != &p_other)
+			{
+				if (m_handle)
+				{
+					m_handle.destroy();
+				}
+				m_handle = std::exchange(p_other.m_handle, nullptr);
+			}
+			return *this;
+		}
+
+		auto operator co_await() noexcept
+		{
+			struct awaiter
+			{
+				std::coroutine_handle<promise_type> m_handle;
+
+				auto await_ready() const noexcept -> bool { return false; }
+
+				auto await_suspend(std::coroutine_handle<> p_awaiting) noexcept -> std::coroutine_handle<>
+				{
+					m_handle.promise().m_continuation = p_awaiting;
+					return m_handle;
+				}
+
+				auto await_resume() -> void
+				{
+					if (m_handle.promise().m_error)
+					{
+						std::rethrow_exception(m_handle.promise().m_error);
+					}
+				}
+			};
+
+			return awaiter{m_handle};
+		}
+	};
+
+	/**
+	 * @brief Awaitable that moves the coroutine onto a pool worker
+	 *
+	 * co_await schedule_on() resumes the current coroutine on the shared
+	 * task_scheduler; everything after the co_await runs on a worker.
+	 */
+	struct schedule_awaitable
+	{
+		task_scheduler* m_scheduler;
+
+		auto await_ready() const noexcept -> bool { return false; }
+
+		auto await_suspend(std::coroutine_handle<> p_handle) const -> void
+		{
+			m_scheduler->submit([p_handle]() { p_handle.resume(); });
+		}
+
+		auto await_resume() const noexcept -> void {}
+	};
+
+	inline auto schedule_on(task_scheduler& p_scheduler = task_scheduler::instance()) -> schedule_awaitable { return schedule_awaitable{&p_scheduler}; }
+
+	/**
+	 * @brief Awaiter adapting a std::future to co_await
+	 *
+	 * Ready futures resume inline; otherwise a pool task parks on the
+	 * future and resumes the coroutine on a worker when the value lands.
+	 * This is what makes file::async_read / async_write awaitable: their
+	 * futures complete from the io_uring reactor, so the wait occupies a
+	 * worker only for the in-flight gap.
+	 */
+	template <typename value_t> class future_awaiter
+	{
+	private:
+		std::future<value_t> m_future;
+
+	public:
+		explicit future_awaiter(std::future<value_t> p_future) : m_future(std::move(p_future)) {}
+
+		auto await_ready() -> bool { return m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+
+		auto await_suspend(std::coroutine_handle<> p_handle) -> void
+		{
+			// The awaiter lives in the suspended frame, so capturing this is safe
+			task_scheduler::instance().submit(
+				[this, p_handle]()
+				{
+					m_future.wait();
+					p_handle.resume();
+				});
+		}
+
+		auto await_resume() -> value_t { return m_future.get(); }
+	};
+
+	template <typename value_t> auto await_future(std::future<value_t> p_future) -> future_awaiter<value_t>
+	{
+		return future_awaiter<value_t>(std::move(p_future));
+	}
+
+	// Found by ADL when value_t involves a utils type, which covers the
+	// expected<>-based futures of the async file API
+	template <typename value_t> auto operator co_await(std::future<value_t>&& p_future) -> future_awaiter<value_t>
+	{
+		return future_awaiter<value_t>(std::move(p_future));
+	}
+
+	namespace coro_detail
+	{
+		struct sync_state
+		{
+			std::mutex m_mutex;
+			std::condition_variable m_cv;
+			bool m_done = false;
+
+			auto signal() -> void
+			{
+				// Notify under the lock: the waiter destroys this state as
+				// soon as it returns, which it cannot do before the unlock
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_done = true;
+				m_cv.notify_one();
+			}
+
+			auto wait() -> void
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_cv.wait(lock, [this]() { return m_done; });
+			}
+		};
+
+		// Eager, self-destroying driver frame for sync_wait and spawn
+		struct driver_task
+		{
+			struct promise_type
+			{
+				auto get_return_object() noexcept -> driver_task { return {}; }
+
+				auto initial_suspend() noexcept -> std::suspend_never { return {}; }
+
+				auto final_suspend() noexcept -> std::suspend_never { return {}; }
+
+				auto return_void() noexcept -> void {}
+
+				auto unhandled_exception() noexcept -> void { std::terminate(); }
+			};
+		};
+
+		template <typename value_t>
+		inline auto run_sync(task<value_t>& p_task, std::optional<value_t>& p_result, std::exception_ptr& p_error, sync_state& p_state) -> driver_task
+		{
+			try
+			{
+				p_result.emplace(co_await p_task);
+			}
+			catch (...)
+			{
+				p_error = std::current_exception();
+			}
+			p_state.signal();
+		}
+
+		inline auto run_sync_void(task<void>& p_task, std::exception_ptr& p_error, sync_state& p_state) -> driver_task
+		{
+			try
+			{
+				co_await p_task;
+			}
+			catch (...)
+			{
+				p_error = std::current_exception();
+			}
+			p_state.signal();
+		}
+
+		inline auto run_detached(task<void> p_task) -> driver_task { co_await p_task; }
+	}	 // namespace coro_detail
+
+	/**
+	 * @brief Runs a task to completion on the calling thread's watch
+	 *
+	 * Bridges coroutine code into synchronous callers: starts the task,
+	 * blocks until it finishes (resumptions may hop through pool workers),
+	 * and returns its value or rethrows its exception.
+	 */
+	template <typename value_t> auto sync_wait(task<value_t> p_task) -> value_t
+	{
+		coro_detail::sync_state state;
+		std::optional<value_t> result;
+		std::exception_ptr error;
+		coro_detail::run_sync(p_task, result, error, state);
+		state.wait();
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+		return std::move(*result);
+	}
+
+	inline auto sync_wait(task<void> p_task) -> void
+	{
+		coro_detail::sync_state state;
+		std::exception_ptr error;
+		coro_detail::run_sync_void(p_task, error, state);
+		state.wait();
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+
+	/**
+	 * @brief Starts a task detached; the frame frees itself on completion
+	 */
+	inline auto spawn(task<void> p_task) -> void { coro_detail::run_detached(std::move(p_task)); }
+
+	/**
+	 * @brief co_await access to a child process's stdout lines
+	 *
+	 * Sits on the process line callback: attach() before execute_async(),
+	 * then co_await next_line() yields each complete line and nullopt at
+	 * end of stream. watch() parks a pool task on process::wait() to mark
+	 * the end of stream when the child exits. Single consumer.
+	 */
+	class async_line_reader
+	{
+	public:
+		using self_t = async_line_reader;
+
+	private:
+		std::mutex m_mutex;
+		std::deque<std::string> m_lines;
+		std::coroutine_handle<> m_waiter;
+		bool m_eof = false;
+
+	public:
+		async_line_reader() = default;
+
+		async_line_reader(const self_t&)		 = delete;
+		auto operator=(const self_t&) -> self_t& = delete;
+
+		// Routes the process's stdout lines into this reader. The reader
+		// must outlive the process's execution.
+		auto attach(process& p_process) -> void
+		{
+			p_process.set_stdout_line_callback(
+				[this](const process::line_batch_t& p_batch)
+				{
+					std::coroutine_handle<> waiter;
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+						for (const auto& line : p_batch)
+						{
+							m_lines.emplace_back(line.data(), line.size());
+						}
+						waiter = std::exchange(m_waiter, nullptr);
+					}
+					resume_waiter(waiter);
+				});
+		}
+
+		// Marks end of stream once the child exits and its output drained
+		auto watch(process& p_process) -> void
+		{
+			task_scheduler::instance().submit(
+				[this, &p_process]()
+				{
+					p_process.wait();
+					mark_eof();
+				});
+		}
+
+		auto mark_eof() -> void
+		{
+			std::coroutine_handle<> waiter;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_eof  = true;
+				waiter = std::exchange(m_waiter, nullptr);
+			}
+			resume_waiter(waiter);
+		}
+
+		auto next_line()
+		{
+			struct awaiter
+			{
+				self_t* m_reader;
+
+				auto await_ready() const noexcept -> bool { return false; }
+
+				auto await_suspend(std::coroutine_handle<> p_handle) -> bool
+				{
+					std::lock_guard<std::mutex> lock(m_reader->m_mutex);
+					if (!m_reader->m_lines.empty() || m_reader->m_eof)
+					{
+						return false;
+					}
+					m_reader->m_waiter = p_handle;
+					return true;
+				}
+
+				auto await_resume() -> std::optional<std::string>
+				{
+					std::lock_guard<std::mutex> lock(m_reader->m_mutex);
+					if (m_reader->m_lines.empty())
+					{
+						return std::nullopt;
+					}
+					std::optional<std::string> line(std::move(m_reader->m_lines.front()));
+					m_reader->m_lines.pop_front();
+					return line;
+				}
+			};
+
+			return awaiter{this};
+		}
+
+	private:
+		static auto resume_waiter(std::coroutine_handle<> p_waiter) -> void
+		{
+			if (p_waiter)
+			{
+				task_scheduler::instance().submit([p_waiter]() { p_waiter.resume(); });
+			}
+		}
+	};
+}	 // namespace utils
+
+	#endif	  // MACRO_CXX20_ENABLED && __cpp_impl_coroutine
+
+#endif	  // CORO_HPP
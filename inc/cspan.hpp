@@ -3,6 +3,7 @@
 	#define CSPAN_HPP
 
 	#include <algorithm>
+	#include <array>
 	#include <cassert>
 	#include <cstddef>
 	#include <iterator>
@@ -10,12 +11,17 @@
 	#include <type_traits>
 
 	#include "claunder.hpp"
+	#include "cmemory.hpp"
 	#include "utils_macros.hpp"
 
 // NOLINTBEGIN(modernize-type-traits, cppcoreguidelines-pro-bounds-pointer-arithmetic, modernize-avoid-c-arrays)
 
 namespace utils
 {
+	// Forward declarations for the alignment-aware span API
+	template <typename element_t> struct span_split;
+	template <typename element_t, std::size_t align_n> class aligned_cspan;
+
 	namespace detail
 	{
 		// Type helpers for const pointer and reference types
@@ -381,8 +387,155 @@ namespace utils
 		{
 			return cspan<unsigned char>(detail::reinterpret_cast_cspan<unsigned char>(m_data), size_bytes());
 		}
+
+		// The leading elements before the first align_n-byte aligned address;
+		// the whole span if alignment is never reached. Pairing this with the
+		// remainder replaces the hand-rolled prologue in SIMD loops.
+		template <std::size_t align_n> MACRO_NODISCARD auto aligned_prefix() const noexcept -> self_t
+		{
+			static_assert(align_n != 0 && (align_n & (align_n - 1)) == 0, "alignment must be a power of two");
+
+			const std::uintptr_t address	= reinterpret_cast<std::uintptr_t>(m_data);
+			const std::uintptr_t misaligned = address & (align_n - 1);
+			if (misaligned == 0)
+			{
+				return self_t(m_data, 0);
+			}
+
+			const std::uintptr_t bytes_to_align = align_n - misaligned;
+			if ((bytes_to_align % sizeof(element_type)) != 0)
+			{
+				// Element stride never lands on the alignment boundary
+				return self_t(m_data, m_size);
+			}
+
+			const size_type head_count = static_cast<size_type>(bytes_to_align / sizeof(element_type));
+			return self_t(m_data, head_count < m_size ? head_count : m_size);
+		}
+
+		// Splits the span into (head, body, tail): the body starts on a
+		// block_n * sizeof(element) byte boundary and holds a whole number of
+		// block_n-element chunks, so a vector kernel can run it with aligned
+		// full-width loads while head and tail take the scalar path.
+		// Declaration only - defined after span_split below.
+		template <std::size_t block_n> MACRO_NODISCARD auto aligned_chunks() const noexcept -> span_split<element_t>;
+
+		// Re-wraps this span in a type that carries the alignment promise;
+		// asserts the pointer really is aligned. Defined after aligned_cspan.
+		template <std::size_t align_n> MACRO_NODISCARD auto assume_aligned() const noexcept -> aligned_cspan<element_t, align_n>;
+
+		// Bulk copy into p_dest via the cmemory primitives (single mem_copy
+		// for trivially copyable elements); returns the element count copied
+		auto copy_to(cspan<value_type> p_dest) const noexcept -> size_type
+		{
+			const size_type count = std::min(m_size, p_dest.size());
+			copy_dispatch(p_dest.data(), count, std::integral_constant<bool, std::is_trivially_copyable<value_type>::value>{});
+			return count;
+		}
+
+		// Bulk fill via mem_set for single-byte trivial elements, element-wise
+		// assignment otherwise
+		template <bool flag = std::is_const<element_type>::value>
+		auto fill(const value_type& p_value) noexcept -> typename std::enable_if<!flag, void>::type
+		{
+			fill_dispatch(p_value,
+						  std::integral_constant<bool, sizeof(value_type) == 1 && std::is_trivially_copyable<value_type>::value>{});
+		}
+
+	private:
+		auto copy_dispatch(value_type* p_dest, size_type p_count, std::true_type /*trivial*/) const noexcept -> void
+		{
+			if (p_count > 0)
+			{
+				mem_copy(p_dest, m_data, static_cast<std::size_t>(p_count) * sizeof(value_type));
+			}
+		}
+
+		auto copy_dispatch(value_type* p_dest, size_type p_count, std::false_type /*trivial*/) const noexcept -> void
+		{
+			std::copy(m_data, m_data + p_count, p_dest);
+		}
+
+		auto fill_dispatch(const value_type& p_value, std::true_type /*byte*/) noexcept -> void
+		{
+			if (m_size > 0)
+			{
+				mem_set(m_data, static_cast<std::int32_t>(reinterpret_cast<const unsigned char&>(p_value)), static_cast<std::size_t>(m_size));
+			}
+		}
+
+		auto fill_dispatch(const value_type& p_value, std::false_type /*byte*/) noexcept -> void { std::fill(m_data, m_data + m_size, p_value); }
+	};
+
+	// Result of cspan::aligned_chunks - scalar head, aligned vectorizable
+	// body (a whole number of blocks), scalar tail
+	template <typename element_t> struct span_split
+	{
+		cspan<element_t> m_head;
+		cspan<element_t> m_body;
+		cspan<element_t> m_tail;
+
+		span_split(cspan<element_t> p_head, cspan<element_t> p_body, cspan<element_t> p_tail) noexcept : m_head(p_head), m_body(p_body), m_tail(p_tail) {}
+	};
+
+	// A cspan whose type carries an alignment guarantee: data() funnels
+	// through __builtin_assume_aligned so the optimizer can emit aligned
+	// vector loads without a runtime check. Construction asserts the promise.
+	template <typename element_t, std::size_t align_n> class aligned_cspan : public cspan<element_t>
+	{
+		static_assert(align_n != 0 && (align_n & (align_n - 1)) == 0, "alignment must be a power of two");
+
+	public:
+		using self_t	= aligned_cspan<element_t, align_n>;
+		using base_t	= cspan<element_t>;
+		using pointer	= typename base_t::pointer;
+		using size_type = typename base_t::size_type;
+
+		static constexpr std::size_t alignment = align_n;
+
+		aligned_cspan(pointer p_data, size_type p_size) noexcept : base_t(p_data, p_size)
+		{
+			assert((p_data == nullptr || cmemory::is_aligned(p_data, align_n)) && "aligned_cspan pointer violates its alignment promise");
+		}
+
+		MACRO_NODISCARD auto data() const noexcept -> pointer
+		{
+	#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<pointer>(__builtin_assume_aligned(base_t::data(), align_n));
+	#else
+			return base_t::data();
+	#endif
+		}
+
+		MACRO_NODISCARD auto begin() const noexcept -> pointer { return data(); }
+
+		MACRO_NODISCARD auto end() const noexcept -> pointer { return data() + this->size(); }
 	};
 
+	template <typename element_t, std::uintmax_t extent>
+	template <std::size_t block_n>
+	MACRO_NODISCARD auto cspan<element_t, extent>::aligned_chunks() const noexcept -> span_split<element_t>
+	{
+		static_assert(block_n != 0, "block size must be non-zero");
+
+		const self_t head			   = aligned_prefix<block_n * sizeof(element_type)>();
+		const size_type remaining	   = m_size - head.size();
+		const size_type body_count	   = (remaining / block_n) * block_n;
+		const pointer body_data		   = m_data + head.size();
+		const size_type tail_count	   = remaining - body_count;
+
+		return span_split<element_t>(cspan<element_t>(m_data, head.size()),
+									 cspan<element_t>(body_data, body_count),
+									 cspan<element_t>(body_data + body_count, tail_count));
+	}
+
+	template <typename element_t, std::uintmax_t extent>
+	template <std::size_t align_n>
+	MACRO_NODISCARD auto cspan<element_t, extent>::assume_aligned() const noexcept -> aligned_cspan<element_t, align_n>
+	{
+		return aligned_cspan<element_t, align_n>(m_data, m_size);
+	}
+
 	template <typename element_t> MACRO_NODISCARD constexpr auto make_span(element_t* p_data, std::uintmax_t p_size) noexcept -> cspan<element_t>
 	{
 		return cspan<element_t>(p_data, p_size);
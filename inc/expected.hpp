@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <initializer_list>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -371,6 +372,128 @@ namespace utils
 			return static_cast<val_t>(std::forward<def_t>(p_default));
 		}
 
+	private:
+		template <typename result_t, typename fn_t, typename arg_t> static auto map_invoke(std::true_type /*void result*/, fn_t&& p_fn, arg_t&& p_arg) -> result_t
+		{
+			std::forward<fn_t>(p_fn)(std::forward<arg_t>(p_arg));
+			return result_t();
+		}
+
+		template <typename result_t, typename fn_t, typename arg_t> static auto map_invoke(std::false_type /*void result*/, fn_t&& p_fn, arg_t&& p_arg) -> result_t
+		{
+			return result_t(in_place_t{}, std::forward<fn_t>(p_fn)(std::forward<arg_t>(p_arg)));
+		}
+
+	public:
+		/**
+		 * @brief Monadic chaining: invokes p_fn on the value, forwards the error
+		 *
+		 * p_fn must return an expected with the same error type. The rvalue
+		 * overload moves both the value into p_fn and the error into the
+		 * result, so propagation through a chain never copies.
+		 */
+		template <typename fn_t> auto and_then(fn_t&& p_fn) & -> decay_t<decltype(p_fn(std::declval<val_t&>()))>
+		{
+			using result_t = decay_t<decltype(p_fn(std::declval<val_t&>()))>;
+			if (m_has_value)
+			{
+				return std::forward<fn_t>(p_fn)(m_storage.m_value);
+			}
+			return result_t(unexpect, m_storage.m_error);
+		}
+
+		template <typename fn_t> auto and_then(fn_t&& p_fn) const& -> decay_t<decltype(p_fn(std::declval<const val_t&>()))>
+		{
+			using result_t = decay_t<decltype(p_fn(std::declval<const val_t&>()))>;
+			if (m_has_value)
+			{
+				return std::forward<fn_t>(p_fn)(m_storage.m_value);
+			}
+			return result_t(unexpect, m_storage.m_error);
+		}
+
+		template <typename fn_t> auto and_then(fn_t&& p_fn) && -> decay_t<decltype(p_fn(std::declval<val_t&&>()))>
+		{
+			using result_t = decay_t<decltype(p_fn(std::declval<val_t&&>()))>;
+			if (m_has_value)
+			{
+				return std::forward<fn_t>(p_fn)(std::move(m_storage.m_value));
+			}
+			return result_t(unexpect, std::move(m_storage.m_error));
+		}
+
+		/**
+		 * @brief Maps the value through p_fn, forwarding the error unchanged
+		 *
+		 * p_fn returns a plain value (or void); the result is re-wrapped as
+		 * expected<mapped, err_t>.
+		 */
+		template <typename fn_t> auto map(fn_t&& p_fn) & -> expected<decay_t<decltype(p_fn(std::declval<val_t&>()))>, err_t>
+		{
+			using mapped_t = decay_t<decltype(p_fn(std::declval<val_t&>()))>;
+			using result_t = expected<mapped_t, err_t>;
+			if (!m_has_value)
+			{
+				return result_t(unexpect, m_storage.m_error);
+			}
+			return map_invoke<result_t>(std::is_void<mapped_t>{}, std::forward<fn_t>(p_fn), m_storage.m_value);
+		}
+
+		template <typename fn_t> auto map(fn_t&& p_fn) const& -> expected<decay_t<decltype(p_fn(std::declval<const val_t&>()))>, err_t>
+		{
+			using mapped_t = decay_t<decltype(p_fn(std::declval<const val_t&>()))>;
+			using result_t = expected<mapped_t, err_t>;
+			if (!m_has_value)
+			{
+				return result_t(unexpect, m_storage.m_error);
+			}
+			return map_invoke<result_t>(std::is_void<mapped_t>{}, std::forward<fn_t>(p_fn), m_storage.m_value);
+		}
+
+		template <typename fn_t> auto map(fn_t&& p_fn) && -> expected<decay_t<decltype(p_fn(std::declval<val_t&&>()))>, err_t>
+		{
+			using mapped_t = decay_t<decltype(p_fn(std::declval<val_t&&>()))>;
+			using result_t = expected<mapped_t, err_t>;
+			if (!m_has_value)
+			{
+				return result_t(unexpect, std::move(m_storage.m_error));
+			}
+			return map_invoke<result_t>(std::is_void<mapped_t>{}, std::forward<fn_t>(p_fn), std::move(m_storage.m_value));
+		}
+
+		/**
+		 * @brief Maps the error through p_fn, forwarding the value unchanged
+		 */
+		template <typename fn_t> auto map_error(fn_t&& p_fn) & -> expected<val_t, decay_t<decltype(p_fn(std::declval<err_t&>()))> >
+		{
+			using result_t = expected<val_t, decay_t<decltype(p_fn(std::declval<err_t&>()))> >;
+			if (m_has_value)
+			{
+				return result_t(in_place_t{}, m_storage.m_value);
+			}
+			return result_t(unexpect, std::forward<fn_t>(p_fn)(m_storage.m_error));
+		}
+
+		template <typename fn_t> auto map_error(fn_t&& p_fn) const& -> expected<val_t, decay_t<decltype(p_fn(std::declval<const err_t&>()))> >
+		{
+			using result_t = expected<val_t, decay_t<decltype(p_fn(std::declval<const err_t&>()))> >;
+			if (m_has_value)
+			{
+				return result_t(in_place_t{}, m_storage.m_value);
+			}
+			return result_t(unexpect, std::forward<fn_t>(p_fn)(m_storage.m_error));
+		}
+
+		template <typename fn_t> auto map_error(fn_t&& p_fn) && -> expected<val_t, decay_t<decltype(p_fn(std::declval<err_t&&>()))> >
+		{
+			using result_t = expected<val_t, decay_t<decltype(p_fn(std::declval<err_t&&>()))> >;
+			if (m_has_value)
+			{
+				return result_t(in_place_t{}, std::move(m_storage.m_value));
+			}
+			return result_t(unexpect, std::forward<fn_t>(p_fn)(std::move(m_storage.m_error)));
+		}
+
 	public:
 		auto swap(self_t& p_other) noexcept -> void
 		{
@@ -564,6 +687,90 @@ namespace utils
 
 		auto error() const&& noexcept -> const err_t&& { return std::move(m_storage.m_error); }
 
+	private:
+		template <typename result_t, typename fn_t> static auto map_invoke(std::true_type /*void result*/, fn_t&& p_fn) -> result_t
+		{
+			std::forward<fn_t>(p_fn)();
+			return result_t();
+		}
+
+		template <typename result_t, typename fn_t> static auto map_invoke(std::false_type /*void result*/, fn_t&& p_fn) -> result_t
+		{
+			return result_t(in_place_t{}, std::forward<fn_t>(p_fn)());
+		}
+
+	public:
+		/**
+		 * @brief Monadic chaining: invokes p_fn() on success, forwards the error
+		 */
+		template <typename fn_t> auto and_then(fn_t&& p_fn) const& -> decay_t<decltype(p_fn())>
+		{
+			using result_t = decay_t<decltype(p_fn())>;
+			if (m_has_value)
+			{
+				return std::forward<fn_t>(p_fn)();
+			}
+			return result_t(unexpect, m_storage.m_error);
+		}
+
+		template <typename fn_t> auto and_then(fn_t&& p_fn) && -> decay_t<decltype(p_fn())>
+		{
+			using result_t = decay_t<decltype(p_fn())>;
+			if (m_has_value)
+			{
+				return std::forward<fn_t>(p_fn)();
+			}
+			return result_t(unexpect, std::move(m_storage.m_error));
+		}
+
+		/**
+		 * @brief Maps success through p_fn(), forwarding the error unchanged
+		 */
+		template <typename fn_t> auto map(fn_t&& p_fn) const& -> expected<decay_t<decltype(p_fn())>, err_t>
+		{
+			using mapped_t = decay_t<decltype(p_fn())>;
+			using result_t = expected<mapped_t, err_t>;
+			if (!m_has_value)
+			{
+				return result_t(unexpect, m_storage.m_error);
+			}
+			return map_invoke<result_t>(std::is_void<mapped_t>{}, std::forward<fn_t>(p_fn));
+		}
+
+		template <typename fn_t> auto map(fn_t&& p_fn) && -> expected<decay_t<decltype(p_fn())>, err_t>
+		{
+			using mapped_t = decay_t<decltype(p_fn())>;
+			using result_t = expected<mapped_t, err_t>;
+			if (!m_has_value)
+			{
+				return result_t(unexpect, std::move(m_storage.m_error));
+			}
+			return map_invoke<result_t>(std::is_void<mapped_t>{}, std::forward<fn_t>(p_fn));
+		}
+
+		/**
+		 * @brief Maps the error through p_fn, forwarding success unchanged
+		 */
+		template <typename fn_t> auto map_error(fn_t&& p_fn) const& -> expected<void, decay_t<decltype(p_fn(std::declval<const err_t&>()))> >
+		{
+			using result_t = expected<void, decay_t<decltype(p_fn(std::declval<const err_t&>()))> >;
+			if (m_has_value)
+			{
+				return result_t();
+			}
+			return result_t(unexpect, std::forward<fn_t>(p_fn)(m_storage.m_error));
+		}
+
+		template <typename fn_t> auto map_error(fn_t&& p_fn) && -> expected<void, decay_t<decltype(p_fn(std::declval<err_t&&>()))> >
+		{
+			using result_t = expected<void, decay_t<decltype(p_fn(std::declval<err_t&&>()))> >;
+			if (m_has_value)
+			{
+				return result_t();
+			}
+			return result_t(unexpect, std::forward<fn_t>(p_fn)(std::move(m_storage.m_error)));
+		}
+
 	public:
 		auto swap(self_t& p_other) noexcept -> void
 		{
@@ -677,6 +884,69 @@ namespace utils
 		return unexpected<decay_t<err_t> >(std::forward<err_t>(p_err));
 	}
 
+	/**
+	 * @brief Lightweight error code for allocation-free failure propagation
+	 *
+	 * Carries a static category name, a numeric value and an optional static
+	 * description - three words, trivially copyable, so expected<T, error_code>
+	 * propagates through a call chain without touching the heap. The human
+	 * readable message is rendered lazily by message(), which is the only
+	 * operation that allocates; keep it on the cold (reporting) path.
+	 */
+	class error_code
+	{
+	public:
+		using self_t = error_code;
+
+	private:
+		const char* m_category;
+		const char* m_text;
+		std::int32_t m_value;
+
+	public:
+		constexpr error_code() noexcept : m_category(""), m_text(""), m_value(0) {}
+
+		constexpr error_code(const char* p_category, std::int32_t p_value, const char* p_text = "") noexcept
+			: m_category(p_category), m_text(p_text), m_value(p_value)
+		{
+		}
+
+		constexpr auto category() const noexcept -> const char* { return m_category; }
+
+		constexpr auto text() const noexcept -> const char* { return m_text; }
+
+		constexpr auto value() const noexcept -> std::int32_t { return m_value; }
+
+		explicit constexpr operator bool() const noexcept { return m_value != 0; }
+
+		/**
+		 * @brief Renders "category: text (value)" - the only allocating call
+		 */
+		auto message() const -> std::string
+		{
+			std::string result(m_category);
+			if (m_text[0] != '\0')
+			{
+				result += ": ";
+				result += m_text;
+			}
+			result += " (";
+			result += std::to_string(m_value);
+			result += ")";
+			return result;
+		}
+	};
+
+	constexpr auto operator==(const error_code& p_lhs, const error_code& p_rhs) noexcept -> bool
+	{
+		return p_lhs.category() == p_rhs.category() && p_lhs.value() == p_rhs.value();
+	}
+
+	constexpr auto operator!=(const error_code& p_lhs, const error_code& p_rhs) noexcept -> bool
+	{
+		return !(p_lhs == p_rhs);
+	}
+
 }	 // namespace utils
 
 #endif	  // EXPECTED_HPP
@@ -1,9 +1,17 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <fcntl.h>
@@ -12,6 +20,19 @@
 #include <sys/sysinfo.h>
 #include <unistd.h>
 
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+
+#if defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#include <linux/io_uring.h>
+		#define UTILS_HAS_IO_URING 1
+	#endif
+#endif
+#ifndef UTILS_HAS_IO_URING
+	#define UTILS_HAS_IO_URING 0
+#endif
+
 #include "cmemory.hpp"
 #include "concepts.hpp"
 #include "debug.hpp"
@@ -160,6 +181,427 @@ namespace utils
 		}
 	}
 
+	namespace detail
+	{
+		// Shared async I/O engine behind file::async_read/async_write. One io_uring
+		// instance multiplexes every file in the process; a single reactor thread
+		// drains completions and fulfills the promises, so queue depth is bounded by
+		// the ring, not by thread count. When the ring is unavailable (old kernel,
+		// seccomp, no header) requests fall back to a small pread/pwrite worker pool.
+		class async_io_engine
+		{
+		public:
+			using self_t   = async_io_engine;
+			using result_t = expected<std::size_t, file_error>;
+			using future_t = std::future<result_t>;
+			using byte_ptr = std::uint8_t*;
+
+		private:
+			struct pending_t
+			{
+				std::promise<result_t> promise;
+				file_error error;
+				bool is_read;
+	#if UTILS_HAS_IO_URING
+				struct iovec iov;
+	#endif
+			};
+
+			struct queued_t
+			{
+				std::promise<result_t> promise;
+				std::int32_t fd;
+				void* read_buf;
+				const void* write_buf;
+				std::size_t length;
+				std::int64_t offset;
+			};
+
+		private:
+	#if UTILS_HAS_IO_URING
+			std::int32_t m_ring_fd = -1;
+			void* m_sq_ring		   = nullptr;
+			void* m_cq_ring		   = nullptr;
+			std::size_t m_sq_ring_bytes = 0;
+			std::size_t m_cq_ring_bytes = 0;
+			struct io_uring_sqe* m_sqes = nullptr;
+			std::size_t m_sqe_bytes		= 0;
+
+			std::uint32_t* m_sq_head  = nullptr;
+			std::uint32_t* m_sq_tail  = nullptr;
+			std::uint32_t* m_sq_mask  = nullptr;
+			std::uint32_t* m_sq_array = nullptr;
+			std::uint32_t* m_cq_head  = nullptr;
+			std::uint32_t* m_cq_tail  = nullptr;
+			std::uint32_t* m_cq_mask  = nullptr;
+			struct io_uring_cqe* m_cqes = nullptr;
+	#endif
+
+			bool m_use_uring = false;
+			std::atomic<bool> m_stop;
+			std::atomic<std::uint64_t> m_next_id;
+
+			std::mutex m_submit_mutex;
+			std::mutex m_pending_mutex;
+			std::unordered_map<std::uint64_t, pending_t> m_pending;
+			std::thread m_reactor;
+
+			std::mutex m_queue_mutex;
+			std::condition_variable m_queue_cv;
+			std::queue<queued_t> m_queue;
+			std::vector<std::thread> m_workers;
+
+		public:
+			static auto instance() -> self_t&
+			{
+				static self_t engine;
+				return engine;
+			}
+
+			auto submit_read(std::int32_t p_fd, void* p_buffer, std::size_t p_size, std::int64_t p_offset) -> future_t
+			{
+				return submit(p_fd, p_buffer, nullptr, p_size, p_offset, true);
+			}
+
+			auto submit_write(std::int32_t p_fd, const void* p_buffer, std::size_t p_size, std::int64_t p_offset) -> future_t
+			{
+				return submit(p_fd, nullptr, p_buffer, p_size, p_offset, false);
+			}
+
+			auto uses_uring() const -> bool { return m_use_uring; }
+
+		private:
+			async_io_engine() : m_stop(false), m_next_id(1)
+			{
+	#if UTILS_HAS_IO_URING
+				m_use_uring = setup_ring();
+	#endif
+				if (m_use_uring)
+				{
+	#if UTILS_HAS_IO_URING
+					m_reactor = std::thread([this]() { reactor_loop(); });
+	#endif
+				}
+				else
+				{
+					std::size_t worker_count = 2;
+					m_workers.reserve(worker_count);
+					for (std::size_t idx_for = 0; idx_for < worker_count; ++idx_for)
+					{
+						m_workers.emplace_back([this]() { worker_loop(); });
+					}
+				}
+				UTILS_DEBUG_LOG("async_io_engine - Started ({})\n", m_use_uring ? "io_uring" : "worker pool");
+			}
+
+			~async_io_engine()
+			{
+				m_stop.store(true, std::memory_order_release);
+				if (m_use_uring)
+				{
+	#if UTILS_HAS_IO_URING
+					submit_nop();
+					if (m_reactor.joinable())
+					{
+						m_reactor.join();
+					}
+					teardown_ring();
+	#endif
+				}
+				else
+				{
+					m_queue_cv.notify_all();
+					for (std::thread& worker : m_workers)
+					{
+						if (worker.joinable())
+						{
+							worker.join();
+						}
+					}
+				}
+			}
+
+			async_io_engine(const self_t&)			 = delete;
+			auto operator=(const self_t&) -> self_t& = delete;
+
+			auto submit(std::int32_t p_fd, void* p_read_buf, const void* p_write_buf, std::size_t p_size, std::int64_t p_offset, bool p_is_read)
+				-> future_t
+			{
+				if (m_use_uring)
+				{
+	#if UTILS_HAS_IO_URING
+					return submit_uring(p_fd, p_read_buf, p_write_buf, p_size, p_offset, p_is_read);
+	#endif
+				}
+
+				queued_t request;
+				request.fd		  = p_fd;
+				request.read_buf  = p_read_buf;
+				request.write_buf = p_write_buf;
+				request.length	  = p_size;
+				request.offset	  = p_offset;
+				future_t result	  = request.promise.get_future();
+				{
+					std::lock_guard<std::mutex> lock(m_queue_mutex);
+					m_queue.push(std::move(request));
+				}
+				m_queue_cv.notify_one();
+				return result;
+			}
+
+	#if UTILS_HAS_IO_URING
+			auto setup_ring() -> bool
+			{
+				struct io_uring_params params;
+				std::memset(&params, 0, sizeof(params));
+
+				long ring_fd = ::syscall(__NR_io_uring_setup, 256, &params);
+				if (ring_fd < 0)
+				{
+					return false;
+				}
+				m_ring_fd = static_cast<std::int32_t>(ring_fd);
+
+				m_sq_ring_bytes = params.sq_off.array + (params.sq_entries * sizeof(std::uint32_t));
+				m_cq_ring_bytes = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+
+				const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+				if (single_mmap)
+				{
+					m_sq_ring_bytes = std::max(m_sq_ring_bytes, m_cq_ring_bytes);
+					m_cq_ring_bytes = m_sq_ring_bytes;
+				}
+
+				m_sq_ring = ::mmap(nullptr, m_sq_ring_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring_fd, IORING_OFF_SQ_RING);
+				if (m_sq_ring == MAP_FAILED)
+				{
+					m_sq_ring = nullptr;
+					teardown_ring();
+					return false;
+				}
+
+				if (single_mmap)
+				{
+					m_cq_ring = m_sq_ring;
+				}
+				else
+				{
+					m_cq_ring = ::mmap(nullptr, m_cq_ring_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring_fd, IORING_OFF_CQ_RING);
+					if (m_cq_ring == MAP_FAILED)
+					{
+						m_cq_ring = nullptr;
+						teardown_ring();
+						return false;
+					}
+				}
+
+				m_sqe_bytes = params.sq_entries * sizeof(struct io_uring_sqe);
+				void* sqes	= ::mmap(nullptr, m_sqe_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring_fd, IORING_OFF_SQES);
+				if (sqes == MAP_FAILED)
+				{
+					teardown_ring();
+					return false;
+				}
+				m_sqes = static_cast<struct io_uring_sqe*>(sqes);
+
+				byte_ptr sq_base = static_cast<byte_ptr>(m_sq_ring);
+				byte_ptr cq_base = static_cast<byte_ptr>(m_cq_ring);
+				m_sq_head		 = reinterpret_cast<std::uint32_t*>(sq_base + params.sq_off.head);
+				m_sq_tail		 = reinterpret_cast<std::uint32_t*>(sq_base + params.sq_off.tail);
+				m_sq_mask		 = reinterpret_cast<std::uint32_t*>(sq_base + params.sq_off.ring_mask);
+				m_sq_array		 = reinterpret_cast<std::uint32_t*>(sq_base + params.sq_off.array);
+				m_cq_head		 = reinterpret_cast<std::uint32_t*>(cq_base + params.cq_off.head);
+				m_cq_tail		 = reinterpret_cast<std::uint32_t*>(cq_base + params.cq_off.tail);
+				m_cq_mask		 = reinterpret_cast<std::uint32_t*>(cq_base + params.cq_off.ring_mask);
+				m_cqes			 = reinterpret_cast<struct io_uring_cqe*>(cq_base + params.cq_off.cqes);
+				return true;
+			}
+
+			auto teardown_ring() -> void
+			{
+				if (m_sqes != nullptr)
+				{
+					::munmap(m_sqes, m_sqe_bytes);
+					m_sqes = nullptr;
+				}
+				if (m_cq_ring != nullptr && m_cq_ring != m_sq_ring)
+				{
+					::munmap(m_cq_ring, m_cq_ring_bytes);
+				}
+				m_cq_ring = nullptr;
+				if (m_sq_ring != nullptr)
+				{
+					::munmap(m_sq_ring, m_sq_ring_bytes);
+					m_sq_ring = nullptr;
+				}
+				if (m_ring_fd >= 0)
+				{
+					::close(m_ring_fd);
+					m_ring_fd = -1;
+				}
+			}
+
+			auto submit_uring(std::int32_t p_fd, void* p_read_buf, const void* p_write_buf, std::size_t p_size, std::int64_t p_offset,
+							  bool p_is_read) -> future_t
+			{
+				const std::uint64_t request_id = m_next_id.fetch_add(1, std::memory_order_relaxed);
+
+				pending_t* entry = nullptr;
+				future_t result;
+				{
+					std::lock_guard<std::mutex> lock(m_pending_mutex);
+					pending_t& slot = m_pending[request_id];
+					slot.error		= p_is_read ? file_error::read_failed : file_error::write_failed;
+					slot.is_read	= p_is_read;
+					// The iovec must stay valid until the completion fires; the map node
+					// gives it a stable address.
+					slot.iov.iov_base = p_is_read ? p_read_buf : const_cast<void*>(p_write_buf);
+					slot.iov.iov_len  = p_size;
+					result			  = slot.promise.get_future();
+					entry			  = &slot;
+				}
+
+				push_sqe(p_is_read ? IORING_OP_READV : IORING_OP_WRITEV, p_fd, &entry->iov, 1, p_offset, request_id);
+				return result;
+			}
+
+			auto submit_nop() -> void { push_sqe(IORING_OP_NOP, -1, nullptr, 0, 0, 0); }
+
+			auto push_sqe(std::uint8_t p_opcode, std::int32_t p_fd, void* p_addr, std::uint32_t p_len, std::int64_t p_offset,
+						  std::uint64_t p_user_data) -> void
+			{
+				std::lock_guard<std::mutex> lock(m_submit_mutex);
+
+				const std::uint32_t mask = *m_sq_mask;
+				const std::uint32_t tail = __atomic_load_n(m_sq_tail, __ATOMIC_ACQUIRE);
+				const std::uint32_t idx	 = tail & mask;
+
+				struct io_uring_sqe* sqe = &m_sqes[idx];
+				std::memset(sqe, 0, sizeof(*sqe));
+				sqe->opcode	   = p_opcode;
+				sqe->fd		   = p_fd;
+				sqe->addr	   = reinterpret_cast<std::uint64_t>(p_addr);
+				sqe->len	   = p_len;
+				sqe->off	   = static_cast<std::uint64_t>(p_offset);
+				sqe->user_data = p_user_data;
+
+				m_sq_array[idx] = idx;
+				__atomic_store_n(m_sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+				::syscall(__NR_io_uring_enter, m_ring_fd, 1, 0, 0, nullptr, 0);
+			}
+
+			auto reactor_loop() -> void
+			{
+				for (;;)
+				{
+					std::uint32_t head		 = __atomic_load_n(m_cq_head, __ATOMIC_ACQUIRE);
+					const std::uint32_t tail = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+
+					if (head == tail)
+					{
+						if (m_stop.load(std::memory_order_acquire))
+						{
+							return;
+						}
+						::syscall(__NR_io_uring_enter, m_ring_fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+						continue;
+					}
+
+					const std::uint32_t mask = *m_cq_mask;
+					while (head != tail)
+					{
+						const struct io_uring_cqe* cqe = &m_cqes[head & mask];
+						complete(cqe->user_data, cqe->res);
+						++head;
+					}
+					__atomic_store_n(m_cq_head, head, __ATOMIC_RELEASE);
+				}
+			}
+
+			auto complete(std::uint64_t p_user_data, std::int32_t p_result) -> void
+			{
+				if (p_user_data == 0)
+				{
+					// Wakeup NOP from the destructor
+					return;
+				}
+
+				pending_t entry;
+				{
+					std::lock_guard<std::mutex> lock(m_pending_mutex);
+					auto iter = m_pending.find(p_user_data);
+					if (iter == m_pending.end())
+					{
+						return;
+					}
+					entry = std::move(iter->second);
+					m_pending.erase(iter);
+				}
+
+				if (p_result < 0)
+				{
+					entry.promise.set_value(unexpected<file_error>(entry.error));
+				}
+				else if (p_result == 0 && entry.is_read && entry.iov.iov_len > 0)
+				{
+					entry.promise.set_value(unexpected<file_error>(file_error::eof_reached));
+				}
+				else
+				{
+					entry.promise.set_value(static_cast<std::size_t>(p_result));
+				}
+			}
+
+	#endif
+
+		private:
+			auto worker_loop() -> void
+			{
+				for (;;)
+				{
+					queued_t request;
+					{
+						std::unique_lock<std::mutex> lock(m_queue_mutex);
+						m_queue_cv.wait(lock, [this]() { return m_stop.load(std::memory_order_acquire) || !m_queue.empty(); });
+						if (m_queue.empty())
+						{
+							return;
+						}
+						request = std::move(m_queue.front());
+						m_queue.pop();
+					}
+
+					ssize_t result = 0;
+					if (request.read_buf != nullptr)
+					{
+						result = ::pread(request.fd, request.read_buf, request.length, request.offset);
+						if (result == 0 && request.length > 0)
+						{
+							request.promise.set_value(unexpected<file_error>(file_error::eof_reached));
+							continue;
+						}
+						if (result < 0)
+						{
+							request.promise.set_value(unexpected<file_error>(file_error::read_failed));
+							continue;
+						}
+					}
+					else
+					{
+						result = ::pwrite(request.fd, request.write_buf, request.length, request.offset);
+						if (result < 0)
+						{
+							request.promise.set_value(unexpected<file_error>(file_error::write_failed));
+							continue;
+						}
+					}
+					request.promise.set_value(static_cast<std::size_t>(result));
+				}
+			}
+		};
+	}	 // namespace detail
+
 	class file
 	{
 	public:
@@ -171,6 +613,31 @@ namespace utils
 		using pos_type	= std::int64_t;
 		using byte_t	= std::uint8_t;
 
+	private:
+		// Double buffer behind the opt-in write-behind mode: write() memcpys into
+		// the active half while the flusher thread drains the sealed half with one
+		// large pwrite, so small records stop paying a syscall each.
+		struct write_behind_state
+		{
+			std::vector<std::uint8_t> buffers[2];
+			std::size_t fill		 = 0;
+			std::int64_t base_offset = 0;
+			std::int32_t active		 = 0;
+
+			bool pending_valid		   = false;
+			std::int32_t pending_index = 0;
+			std::size_t pending_size   = 0;
+			std::int64_t pending_offset = 0;
+
+			std::mutex mutex;
+			std::condition_variable cv;
+			std::condition_variable done_cv;
+			std::thread flusher;
+			bool stop	= false;
+			bool busy	= false;
+			bool failed = false;
+		};
+
 	private:
 		std::int32_t m_fd;
 		fs::path m_path;
@@ -182,6 +649,7 @@ namespace utils
 		bool m_is_open;
 		bool m_is_mmap;
 		bool m_is_ram;
+		std::unique_ptr<write_behind_state> m_write_behind;
 
 	public:
 		~file() { cleanup(); }
@@ -230,7 +698,8 @@ namespace utils
 			  m_position(p_other.m_position),
 			  m_is_open(p_other.m_is_open),
 			  m_is_mmap(p_other.m_is_mmap),
-			  m_is_ram(p_other.m_is_ram)
+			  m_is_ram(p_other.m_is_ram),
+			  m_write_behind(std::move(p_other.m_write_behind))
 		{
 			p_other.m_fd	   = -1;
 			p_other.m_data	   = nullptr;
@@ -257,6 +726,7 @@ namespace utils
 				m_is_open  = p_other.m_is_open;
 				m_is_mmap  = p_other.m_is_mmap;
 				m_is_ram   = p_other.m_is_ram;
+				m_write_behind = std::move(p_other.m_write_behind);
 
 				p_other.m_fd	   = -1;
 				p_other.m_data	   = nullptr;
@@ -273,6 +743,11 @@ namespace utils
 	private:
 		auto cleanup() -> void
 		{
+			if (m_write_behind != nullptr)
+			{
+				drain_write_behind();
+				stop_write_behind();
+			}
 			if (m_is_mmap && m_data != nullptr)
 			{
 				::munmap(m_data, m_size);
@@ -459,6 +934,13 @@ namespace utils
 				return unexpected<error_t>(error_t::not_open);
 			}
 
+			// Write-behind keeps recent writes in the double buffer; land them on
+			// the fd first or read-after-write returns stale bytes
+			if (m_write_behind != nullptr && !drain_write_behind())
+			{
+				return unexpected<error_t>(error_t::flush_failed);
+			}
+
 			size_type available = m_size - m_position;
 			size_type to_read	= std::min(p_size, available);
 
@@ -499,6 +981,11 @@ namespace utils
 				return unexpected<error_t>(error_t::write_failed);
 			}
 
+			if (m_write_behind != nullptr)
+			{
+				return write_buffered(p_buffer, p_size);
+			}
+
 			if (m_is_ram && m_data != nullptr)
 			{
 				size_type new_size = m_position + p_size;
@@ -547,6 +1034,301 @@ namespace utils
 
 		auto write(const std::string& p_data) -> expected<size_type, error_t> { return write(p_data.data(), p_data.size()); }
 
+		// Opt into write-behind buffering: write() becomes a memcpy into the
+		// active half of a double buffer and a background thread flushes sealed
+		// halves with one large pwrite each. flush() keeps its strong meaning —
+		// it drains the buffers and fsyncs before returning. Only available for
+		// direct-fd files; RAM-buffered files already batch in memory.
+		auto enable_write_behind(size_type p_buffer_size = static_cast<size_type>(mem_size::small)) -> expected<void, error_t>
+		{
+			if (!m_is_open || !(m_mode & mode_t::write))
+			{
+				return unexpected<error_t>(error_t::not_open);
+			}
+			if (m_is_mmap || m_data != nullptr)
+			{
+				return unexpected<error_t>(error_t::invalid_mode);
+			}
+			if (m_write_behind != nullptr)
+			{
+				return {};
+			}
+
+			m_write_behind = std::unique_ptr<write_behind_state>(new write_behind_state());
+			m_write_behind->buffers[0].resize(p_buffer_size);
+			m_write_behind->buffers[1].resize(p_buffer_size);
+			m_write_behind->base_offset = m_position;
+
+			write_behind_state* state = m_write_behind.get();
+			const std::int32_t fd	  = m_fd;
+			state->flusher			  = std::thread(
+				 [state, fd]()
+				 {
+					 std::unique_lock<std::mutex> lock(state->mutex);
+					 for (;;)
+					 {
+						 state->cv.wait(lock, [state]() { return state->stop || state->pending_valid; });
+						 if (state->pending_valid)
+						 {
+							 const std::int32_t index  = state->pending_index;
+							 const std::size_t length  = state->pending_size;
+							 const std::int64_t offset = state->pending_offset;
+							 state->pending_valid	   = false;
+							 state->busy			   = true;
+							 lock.unlock();
+
+							 std::size_t written = 0;
+							 while (written < length)
+							 {
+								 ssize_t result = ::pwrite(fd, state->buffers[index].data() + written, length - written,
+														   static_cast<off_t>(offset) + static_cast<off_t>(written));
+								 if (result <= 0)
+								 {
+									 break;
+								 }
+								 written += static_cast<std::size_t>(result);
+							 }
+
+							 lock.lock();
+							 state->busy = false;
+							 if (written < length)
+							 {
+								 state->failed = true;
+							 }
+							 state->done_cv.notify_all();
+							 continue;
+						 }
+						 return;
+					 }
+				 });
+
+			UTILS_DEBUG_LOG("file::enable_write_behind() - Enabled ({} byte buffers)\n", p_buffer_size);
+			return {};
+		}
+
+		auto disable_write_behind() -> expected<void, error_t>
+		{
+			if (m_write_behind == nullptr)
+			{
+				return {};
+			}
+
+			const bool drained = drain_write_behind();
+			stop_write_behind();
+			if (!drained)
+			{
+				return unexpected<error_t>(error_t::write_failed);
+			}
+			return {};
+		}
+
+		auto is_write_behind() const -> bool { return m_write_behind != nullptr; }
+
+	private:
+		auto write_buffered(const void* p_buffer, size_type p_size) -> expected<size_type, error_t>
+		{
+			write_behind_state& state = *m_write_behind;
+			{
+				std::lock_guard<std::mutex> lock(state.mutex);
+				if (state.failed)
+				{
+					return unexpected<error_t>(error_t::write_failed);
+				}
+			}
+
+			// A seek since the last record breaks contiguity; seal the buffer and
+			// restart the run at the new offset
+			if (m_position != state.base_offset + static_cast<pos_type>(state.fill))
+			{
+				if (!seal_active_buffer())
+				{
+					return unexpected<error_t>(error_t::write_failed);
+				}
+				state.base_offset = m_position;
+			}
+
+			if (p_size >= state.buffers[0].size())
+			{
+				// Oversized record: flush what is buffered, then write it directly
+				if (!seal_active_buffer())
+				{
+					return unexpected<error_t>(error_t::write_failed);
+				}
+				state.base_offset = m_position;
+
+				std::size_t written = 0;
+				const byte_t* bytes = static_cast<const byte_t*>(p_buffer);
+				while (written < p_size)
+				{
+					ssize_t result = ::pwrite(m_fd, bytes + written, p_size - written, static_cast<off_t>(m_position) + static_cast<off_t>(written));
+					if (result <= 0)
+					{
+						return unexpected<error_t>(error_t::write_failed);
+					}
+					written += static_cast<std::size_t>(result);
+				}
+				m_position += static_cast<pos_type>(p_size);
+				state.base_offset = m_position;
+				if (m_position > static_cast<pos_type>(m_size))
+				{
+					m_size = static_cast<size_type>(m_position);
+				}
+				return p_size;
+			}
+
+			if (state.fill + p_size > state.buffers[0].size())
+			{
+				if (!seal_active_buffer())
+				{
+					return unexpected<error_t>(error_t::write_failed);
+				}
+				state.base_offset = m_position;
+			}
+
+			std::memcpy(state.buffers[state.active].data() + state.fill, p_buffer, p_size);
+			state.fill += p_size;
+			m_position += static_cast<pos_type>(p_size);
+			if (m_position > static_cast<pos_type>(m_size))
+			{
+				m_size = static_cast<size_type>(m_position);
+			}
+			return p_size;
+		}
+
+		// Hand the active buffer to the flusher and switch halves; waits only if
+		// the flusher is still busy with the previous one
+		auto seal_active_buffer() -> bool
+		{
+			write_behind_state& state = *m_write_behind;
+			if (state.fill == 0)
+			{
+				return true;
+			}
+
+			std::unique_lock<std::mutex> lock(state.mutex);
+			state.done_cv.wait(lock, [&state]() { return !state.pending_valid && !state.busy; });
+			if (state.failed)
+			{
+				return false;
+			}
+
+			state.pending_index	 = state.active;
+			state.pending_size	 = state.fill;
+			state.pending_offset = state.base_offset;
+			state.pending_valid	 = true;
+
+			state.active	  = 1 - state.active;
+			state.fill		  = 0;
+			state.base_offset = state.base_offset + static_cast<pos_type>(state.pending_size);
+			state.cv.notify_one();
+			return true;
+		}
+
+		auto drain_write_behind() -> bool
+		{
+			if (m_write_behind == nullptr)
+			{
+				return true;
+			}
+
+			write_behind_state& state = *m_write_behind;
+			if (!seal_active_buffer())
+			{
+				return false;
+			}
+
+			std::unique_lock<std::mutex> lock(state.mutex);
+			state.done_cv.wait(lock, [&state]() { return !state.pending_valid && !state.busy; });
+			return !state.failed;
+		}
+
+		auto stop_write_behind() -> void
+		{
+			if (m_write_behind == nullptr)
+			{
+				return;
+			}
+
+			write_behind_state& state = *m_write_behind;
+			{
+				std::lock_guard<std::mutex> lock(state.mutex);
+				state.stop = true;
+			}
+			state.cv.notify_one();
+			if (state.flusher.joinable())
+			{
+				state.flusher.join();
+			}
+			m_write_behind.reset();
+		}
+
+	public:
+
+		// Positioned async I/O (pread/pwrite semantics): the explicit offset keeps
+		// concurrent requests independent of m_position, which is never touched.
+		auto async_read(void* p_buffer, size_type p_size, pos_type p_offset) -> detail::async_io_engine::future_t
+		{
+			if (!m_is_open)
+			{
+				return ready_result(unexpected<error_t>(error_t::not_open));
+			}
+
+			if (m_data != nullptr)
+			{
+				// Already resident (RAM or mmap); serve the request immediately
+				if (p_offset >= static_cast<pos_type>(m_size))
+				{
+					return ready_result(unexpected<error_t>(error_t::eof_reached));
+				}
+				size_type available = m_size - static_cast<size_type>(p_offset);
+				size_type to_read	= std::min(p_size, available);
+				std::memcpy(p_buffer, m_data + p_offset, to_read);
+				return ready_result(to_read);
+			}
+
+			return detail::async_io_engine::instance().submit_read(m_fd, p_buffer, p_size, p_offset);
+		}
+
+		auto async_write(const void* p_buffer, size_type p_size, pos_type p_offset) -> detail::async_io_engine::future_t
+		{
+			if (!m_is_open || !(m_mode & mode_t::write))
+			{
+				return ready_result(unexpected<error_t>(error_t::not_open));
+			}
+
+			if (m_is_mmap)
+			{
+				return ready_result(unexpected<error_t>(error_t::write_failed));
+			}
+
+			if (m_is_ram && m_data != nullptr)
+			{
+				// RAM-buffered files mutate the in-memory copy; route through the
+				// synchronous path so buffer growth stays in one place
+				auto saved_pos = m_position;
+				m_position	   = p_offset;
+				auto result	   = write(p_buffer, p_size);
+				m_position	   = saved_pos;
+				if (!result)
+				{
+					return ready_result(unexpected<error_t>(result.error()));
+				}
+				return ready_result(result.value());
+			}
+
+			return detail::async_io_engine::instance().submit_write(m_fd, p_buffer, p_size, p_offset);
+		}
+
+	private:
+		static auto ready_result(detail::async_io_engine::result_t p_result) -> detail::async_io_engine::future_t
+		{
+			std::promise<detail::async_io_engine::result_t> promise;
+			promise.set_value(std::move(p_result));
+			return promise.get_future();
+		}
+
+	public:
+
 		auto data() const -> const byte_t* { return m_data; }
 
 		auto data() -> byte_t* { return (m_mode & mode_t::write) ? m_data : nullptr; }
@@ -602,6 +1384,11 @@ namespace utils
 				return unexpected<error_t>(error_t::not_open);
 			}
 
+			if (m_write_behind != nullptr && !drain_write_behind())
+			{
+				return unexpected<error_t>(error_t::flush_failed);
+			}
+
 			if (m_is_ram && (m_mode & mode_t::write) && m_data != nullptr && !m_is_mmap)
 			{
 				::lseek(m_fd, 0, SEEK_SET);
@@ -662,6 +1449,215 @@ namespace utils
 			return {};
 		}
 
+		// Ship the whole file into another open file without staging it in
+		// userspace; falls back to buffered copying only when the kernel paths
+		// cannot apply (RAM-buffered destination, filesystem without support).
+		auto transfer_to(self_t& p_dest) -> expected<size_type, error_t>
+		{
+			if (!m_is_open || !p_dest.m_is_open)
+			{
+				return unexpected<error_t>(error_t::not_open);
+			}
+			if (!(p_dest.m_mode & mode_t::write) || p_dest.m_is_mmap)
+			{
+				return unexpected<error_t>(error_t::write_failed);
+			}
+
+			// Both fds are used directly below; drain any write-behind buffers so
+			// the source bytes are current and the destination stays ordered
+			if (m_write_behind != nullptr && !drain_write_behind())
+			{
+				return unexpected<error_t>(error_t::flush_failed);
+			}
+			if (p_dest.m_write_behind != nullptr && !p_dest.drain_write_behind())
+			{
+				return unexpected<error_t>(error_t::flush_failed);
+			}
+
+			if (m_size == 0)
+			{
+				return size_type(0);
+			}
+
+			if (p_dest.m_is_ram && p_dest.m_data != nullptr)
+			{
+				// Destination lives in memory; bytes have to enter userspace anyway
+				return buffered_transfer(p_dest);
+			}
+
+			if (m_is_ram && m_data != nullptr && (m_mode & mode_t::write))
+			{
+				// Source has unflushed in-memory state; the fd contents are stale
+				return buffered_transfer(p_dest);
+			}
+
+			::lseek(p_dest.m_fd, p_dest.m_position, SEEK_SET);
+			auto result = kernel_transfer(m_fd, p_dest.m_fd, m_size);
+			if (result)
+			{
+				p_dest.m_position += static_cast<pos_type>(result.value());
+				if (p_dest.m_position > static_cast<pos_type>(p_dest.m_size))
+				{
+					p_dest.m_size = static_cast<size_type>(p_dest.m_position);
+				}
+			}
+			return result;
+		}
+
+		// Same transfer toward a raw descriptor (socket, pipe, plain fd); bytes
+		// land at the descriptor's current offset
+		auto transfer_to_fd(std::int32_t p_fd) -> expected<size_type, error_t>
+		{
+			if (!m_is_open)
+			{
+				return unexpected<error_t>(error_t::not_open);
+			}
+			if (m_write_behind != nullptr && !drain_write_behind())
+			{
+				return unexpected<error_t>(error_t::flush_failed);
+			}
+			if (m_size == 0)
+			{
+				return size_type(0);
+			}
+
+			if (m_is_ram && m_data != nullptr && (m_mode & mode_t::write))
+			{
+				return write_all_to_fd(p_fd, m_data, m_size);
+			}
+
+			return kernel_transfer(m_fd, p_fd, m_size);
+		}
+
+	private:
+		auto buffered_transfer(self_t& p_dest) -> expected<size_type, error_t>
+		{
+			if (m_data != nullptr)
+			{
+				auto result = p_dest.write(m_data, m_size);
+				if (!result)
+				{
+					return unexpected<error_t>(result.error());
+				}
+				return result.value();
+			}
+
+			std::vector<byte_t> chunk(static_cast<size_type>(mem_size::tiny));
+			size_type total = 0;
+			while (total < m_size)
+			{
+				const size_type to_read = std::min(chunk.size(), m_size - total);
+				ssize_t bytes_read		= ::pread(m_fd, chunk.data(), to_read, static_cast<off_t>(total));
+				if (bytes_read <= 0)
+				{
+					return unexpected<error_t>(error_t::read_failed);
+				}
+				auto written = p_dest.write(chunk.data(), static_cast<size_type>(bytes_read));
+				if (!written)
+				{
+					return unexpected<error_t>(written.error());
+				}
+				total += static_cast<size_type>(bytes_read);
+			}
+			return total;
+		}
+
+		static auto write_all_to_fd(std::int32_t p_fd, const byte_t* p_data, size_type p_size) -> expected<size_type, error_t>
+		{
+			size_type total = 0;
+			while (total < p_size)
+			{
+				ssize_t written = ::write(p_fd, p_data + total, p_size - total);
+				if (written <= 0)
+				{
+					return unexpected<error_t>(error_t::write_failed);
+				}
+				total += static_cast<size_type>(written);
+			}
+			return total;
+		}
+
+		// Cascade of in-kernel copy paths, each resuming where the previous one
+		// stopped: copy_file_range (reflink-capable, file-to-file), sendfile
+		// (file-to-socket and older kernels), splice (pipe destinations), then a
+		// plain pread/write loop when no kernel path applies.
+		static auto kernel_transfer(std::int32_t p_in_fd, std::int32_t p_out_fd, size_type p_count) -> expected<size_type, error_t>
+		{
+			size_type total = 0;
+
+	#if defined(__NR_copy_file_range)
+			{
+				loff_t off_in = 0;
+				while (total < p_count)
+				{
+					long moved = ::syscall(__NR_copy_file_range, p_in_fd, &off_in, p_out_fd, nullptr, p_count - total, 0U);
+					if (moved <= 0)
+					{
+						break;
+					}
+					total += static_cast<size_type>(moved);
+				}
+			}
+			if (total == p_count)
+			{
+				return total;
+			}
+	#endif
+
+			{
+				off_t off_in = static_cast<off_t>(total);
+				while (total < p_count)
+				{
+					ssize_t moved = ::sendfile(p_out_fd, p_in_fd, &off_in, p_count - total);
+					if (moved <= 0)
+					{
+						break;
+					}
+					total += static_cast<size_type>(moved);
+				}
+			}
+			if (total == p_count)
+			{
+				return total;
+			}
+
+			{
+				loff_t off_in = static_cast<loff_t>(total);
+				while (total < p_count)
+				{
+					ssize_t moved = ::splice(p_in_fd, &off_in, p_out_fd, nullptr, p_count - total, SPLICE_F_MOVE);
+					if (moved <= 0)
+					{
+						break;
+					}
+					total += static_cast<size_type>(moved);
+				}
+			}
+			if (total == p_count)
+			{
+				return total;
+			}
+
+			std::vector<byte_t> chunk(static_cast<size_type>(mem_size::tiny));
+			while (total < p_count)
+			{
+				const size_type to_read = std::min(chunk.size(), p_count - total);
+				ssize_t bytes_read		= ::pread(p_in_fd, chunk.data(), to_read, static_cast<off_t>(total));
+				if (bytes_read <= 0)
+				{
+					return unexpected<error_t>(error_t::read_failed);
+				}
+				auto written = write_all_to_fd(p_out_fd, chunk.data(), static_cast<size_type>(bytes_read));
+				if (!written)
+				{
+					return unexpected<error_t>(written.error());
+				}
+				total += static_cast<size_type>(bytes_read);
+			}
+			return total;
+		}
+
+	public:
 		auto read_all() -> expected<std::vector<byte_t>, error_t>
 		{
 			if (!m_is_open)
@@ -2,8 +2,14 @@
 #ifndef FILE_VIEW_HPP
 	#define FILE_VIEW_HPP
 
+	#include <atomic>
+	#include <chrono>
+	#include <condition_variable>
 	#include <cstdint>
+	#include <mutex>
+	#include <thread>
 	#include <utility>
+	#include <vector>
 
 	#include <fcntl.h>
 	#include <sys/mman.h>
@@ -93,6 +99,12 @@ namespace utils
 		eof_reached
 	};
 
+	enum class page_mode : std::uint8_t
+	{
+		normal = 0,
+		huge   = 1
+	};
+
 	class file_view
 	{
 	public:
@@ -106,13 +118,15 @@ namespace utils
 		std::uintmax_t m_file_size	   = 0;
 		std::uintmax_t m_page_size	   = 0;
 		std::uintmax_t m_prefetch_size = 0;
+		std::uintmax_t m_map_length	   = 0;
 		open_mode m_mode			   = open_mode::read;
+		bool m_anon_copy			   = false;
 
 	public:
 		~file_view() { close_descriptor(); }
 
 		// NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
-		explicit file_view(fs::path p_path, open_mode p_mode = open_mode::read)
+		explicit file_view(fs::path p_path, open_mode p_mode = open_mode::read, page_mode p_pages = page_mode::normal)
 			: m_path(std::move(p_path)), m_page_size(static_cast<std::uintmax_t>(::sysconf(_SC_PAGESIZE))), m_mode(p_mode)
 		{
 			std::int32_t flags = O_CLOEXEC;
@@ -157,6 +171,18 @@ namespace utils
 			{
 				return;
 			}
+
+			// Huge-page mode: copy the file into a THP-eligible anonymous mapping
+			// so random lookups hit 2 MiB TLB entries. Read-only views only (the
+			// copy never writes back) and size-gated so it cannot starve the host.
+			if (p_pages == page_mode::huge && !(m_mode & open_mode::write) && m_file_size <= mem_available_bytes() / 2)
+			{
+				if (map_huge_copy())
+				{
+					return;
+				}
+			}
+
 			if (m_file_size <= mem_size::medium)
 			{
 				file_posix_advise(POSIX_FADV_SEQUENTIAL);
@@ -189,6 +215,13 @@ namespace utils
 			const std::int32_t prot = (m_mode & open_mode::write) ? (PROT_READ | PROT_WRITE) : PROT_READ;
 			m_map					= ::mmap(nullptr, static_cast<std::size_t>(m_file_size), prot, mmap_flags, m_file_descriptor, 0);
 
+			if (m_map == MAP_FAILED && (mmap_flags & MAP_HUGETLB) != 0)
+			{
+				// No hugetlbfs pool reserved; retry with normal pages
+				mmap_flags &= ~MAP_HUGETLB;
+				m_map = ::mmap(nullptr, static_cast<std::size_t>(m_file_size), prot, mmap_flags, m_file_descriptor, 0);
+			}
+
 			if (m_map == MAP_FAILED)
 			{
 				close_descriptor();
@@ -202,12 +235,19 @@ namespace utils
 		auto operator=(const self_t&) -> self_t& = delete;
 
 		file_view(self_t&& p_other) noexcept
-			: m_file_descriptor(p_other.m_file_descriptor), m_map(p_other.m_map), m_file_size(p_other.m_file_size), m_page_size(p_other.m_page_size)
+			: m_file_descriptor(p_other.m_file_descriptor),
+			  m_map(p_other.m_map),
+			  m_file_size(p_other.m_file_size),
+			  m_page_size(p_other.m_page_size),
+			  m_map_length(p_other.m_map_length),
+			  m_anon_copy(p_other.m_anon_copy)
 		{
 			p_other.m_file_descriptor = -1;
 			p_other.m_map			  = MAP_FAILED;
 			p_other.m_file_size		  = 0;
 			p_other.m_page_size		  = 0;
+			p_other.m_map_length	  = 0;
+			p_other.m_anon_copy		  = false;
 		}
 
 		auto operator=(self_t&& p_other) noexcept -> self_t&
@@ -220,11 +260,15 @@ namespace utils
 				m_map			  = p_other.m_map;
 				m_file_size		  = p_other.m_file_size;
 				m_page_size		  = p_other.m_page_size;
+				m_map_length	  = p_other.m_map_length;
+				m_anon_copy		  = p_other.m_anon_copy;
 
 				p_other.m_file_descriptor = -1;
 				p_other.m_map			  = MAP_FAILED;
 				p_other.m_file_size		  = 0;
 				p_other.m_page_size		  = 0;
+				p_other.m_map_length	  = 0;
+				p_other.m_anon_copy		  = false;
 			}
 			return *this;
 		}
@@ -292,12 +336,55 @@ namespace utils
 			}
 		}
 
+		// Populate an anonymous mapping (rounded up to the 2 MiB THP granule,
+		// advised MADV_HUGEPAGE) with the file contents, then drop it to
+		// read-only. MAP_HUGETLB is deliberately not used here: it needs a
+		// reserved hugetlbfs pool, while THP collapses pages opportunistically.
+		auto map_huge_copy() -> bool
+		{
+			constexpr std::uintmax_t huge_granule = 2ULL * 1024ULL * 1024ULL;
+			const std::uintmax_t aligned_size	  = ((m_file_size + huge_granule - 1) / huge_granule) * huge_granule;
+
+			void* map = ::mmap(nullptr, static_cast<std::size_t>(aligned_size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (map == MAP_FAILED)
+			{
+				return false;
+			}
+
+	#ifdef MADV_HUGEPAGE
+			::madvise(map, static_cast<std::size_t>(aligned_size), MADV_HUGEPAGE);
+	#endif
+
+			auto* dest			 = static_cast<std::uint8_t*>(map);
+			std::uintmax_t total = 0;
+			while (total < m_file_size)
+			{
+				const ssize_t bytes_read =
+					::pread(m_file_descriptor, dest + total, static_cast<std::size_t>(m_file_size - total), static_cast<off_t>(total));
+				if (bytes_read <= 0)
+				{
+					::munmap(map, static_cast<std::size_t>(aligned_size));
+					return false;
+				}
+				total += static_cast<std::uintmax_t>(bytes_read);
+			}
+
+			::mprotect(map, static_cast<std::size_t>(aligned_size), PROT_READ);
+
+			m_map		 = map;
+			m_map_length = aligned_size;
+			m_anon_copy	 = true;
+			return true;
+		}
+
 		auto unmap() noexcept -> void
 		{
 			if (is_mapped())
 			{
-				::munmap(m_map, static_cast<std::size_t>(m_file_size));
-				m_map = MAP_FAILED;
+				::munmap(m_map, static_cast<std::size_t>(m_map_length != 0 ? m_map_length : m_file_size));
+				m_map		 = MAP_FAILED;
+				m_map_length = 0;
+				m_anon_copy	 = false;
 			}
 		}
 
@@ -333,6 +420,8 @@ namespace utils
 
 		MACRO_NODISCARD auto is_open() const noexcept -> bool { return m_file_descriptor >= 0; }
 
+		MACRO_NODISCARD auto is_huge_copy() const noexcept -> bool { return m_anon_copy; }
+
 		MACRO_NODISCARD auto begin() const noexcept -> const std::uint8_t* { return data(); }
 
 		MACRO_NODISCARD auto end() const noexcept -> const std::uint8_t* { return data() + size(); }
@@ -403,5 +492,539 @@ namespace utils
 			}
 		}
 	};
+
+	// Line index over a memory-mapped text file. One memchr pass (vectorized by
+	// libc) collects the start offset of every line, giving O(1) access to line N
+	// and equal-sized line ranges for parallel consumers. The index can be saved
+	// next to the file and reloaded, turning query cold-start into a single read;
+	// a stored index is rejected if the file size no longer matches. Non-owning:
+	// the view must outlive the index.
+	class line_index
+	{
+	public:
+		using self_t = line_index;
+
+		struct line_t
+		{
+			const char* m_data	  = nullptr;
+			std::uintmax_t m_size = 0;
+
+			MACRO_NODISCARD auto data() const noexcept -> const char* { return m_data; }
+
+			MACRO_NODISCARD auto size() const noexcept -> std::uintmax_t { return m_size; }
+
+			MACRO_NODISCARD auto begin() const noexcept -> const char* { return m_data; }
+
+			MACRO_NODISCARD auto end() const noexcept -> const char* { return m_data + m_size; }
+		};
+
+		struct line_range_t
+		{
+			std::uint64_t m_first = 0;
+			std::uint64_t m_count = 0;
+		};
+
+	private:
+		static constexpr std::uint32_t k_magic	 = 0x58494C55;	  // "ULIX"
+		static constexpr std::uint32_t k_version = 1;
+
+		const file_view* m_view = nullptr;
+		std::vector<std::uint64_t> m_starts;
+
+	public:
+		explicit line_index(const file_view& p_view) : m_view(&p_view)
+		{
+			const auto* base		  = reinterpret_cast<const char*>(m_view->data());
+			const std::uintmax_t size = m_view->size();
+
+			std::uintmax_t offset = 0;
+			while (offset < size)
+			{
+				m_starts.push_back(offset);
+				const auto* newline = static_cast<const char*>(std::memchr(base + offset, '\n', static_cast<std::size_t>(size - offset)));
+				if (newline == nullptr)
+				{
+					break;
+				}
+				offset = static_cast<std::uintmax_t>(newline - base) + 1;
+			}
+		}
+
+		line_index(const file_view& p_view, const fs::path& p_index_path) : m_view(&p_view)
+		{
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+			const std::int32_t descriptor = ::open(p_index_path.c_str(), O_RDONLY | O_CLOEXEC);
+			if (descriptor < 0)
+			{
+				MACRO_THROW(std::runtime_error(std::format("Failed to open line index '{}': {}", p_index_path.string(), ::strerror(errno))));
+			}
+
+			std::uint64_t header[3] = {0, 0, 0};
+			bool valid = ::read(descriptor, header, sizeof(header)) == static_cast<ssize_t>(sizeof(header));
+			valid	   = valid && static_cast<std::uint32_t>(header[0]) == k_magic && static_cast<std::uint32_t>(header[0] >> 32U) == k_version;
+			valid	   = valid && header[1] == m_view->size();
+
+			// The stored count is untrusted: it must match the payload actually on
+			// disk before it sizes an allocation
+			struct stat index_info = {};
+			valid				   = valid && ::fstat(descriptor, &index_info) == 0;
+			valid = valid && static_cast<std::uint64_t>(index_info.st_size) == sizeof(header) + (header[2] * sizeof(std::uint64_t));
+			if (!valid)
+			{
+				::close(descriptor);
+				MACRO_THROW(std::runtime_error(std::format("Line index '{}' is missing or stale", p_index_path.string())));
+			}
+
+			m_starts.resize(static_cast<std::size_t>(header[2]));
+			const auto payload = static_cast<ssize_t>(m_starts.size() * sizeof(std::uint64_t));
+			if (::read(descriptor, m_starts.data(), static_cast<std::size_t>(payload)) != payload)
+			{
+				::close(descriptor);
+				MACRO_THROW(std::runtime_error(std::format("Failed to read line index '{}': {}", p_index_path.string(), ::strerror(errno))));
+			}
+			::close(descriptor);
+
+			// Offsets feed pointer arithmetic in line(); a corrupt index must not
+			// hand out positions past the mapping or break monotonicity
+			for (std::size_t idx_for = 0; idx_for < m_starts.size(); ++idx_for)
+			{
+				const bool in_range	 = m_starts[idx_for] < m_view->size();
+				const bool monotonic = idx_for == 0 || m_starts[idx_for] > m_starts[idx_for - 1];
+				if (!in_range || !monotonic)
+				{
+					MACRO_THROW(std::runtime_error(std::format("Line index '{}' is corrupt", p_index_path.string())));
+				}
+			}
+		}
+
+	public:
+		auto save(const fs::path& p_index_path) const -> void
+		{
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+			const std::int32_t descriptor = ::open(p_index_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+			if (descriptor < 0)
+			{
+				MACRO_THROW(std::runtime_error(std::format("Failed to create line index '{}': {}", p_index_path.string(), ::strerror(errno))));
+			}
+
+			const std::uint64_t header[3] = {static_cast<std::uint64_t>(k_magic) | (static_cast<std::uint64_t>(k_version) << 32U),
+											 m_view->size(), static_cast<std::uint64_t>(m_starts.size())};
+			const auto payload			  = static_cast<ssize_t>(m_starts.size() * sizeof(std::uint64_t));
+			bool valid					  = ::write(descriptor, header, sizeof(header)) == static_cast<ssize_t>(sizeof(header));
+			valid						  = valid && ::write(descriptor, m_starts.data(), static_cast<std::size_t>(payload)) == payload;
+			::close(descriptor);
+			if (!valid)
+			{
+				MACRO_THROW(std::runtime_error(std::format("Failed to write line index '{}': {}", p_index_path.string(), ::strerror(errno))));
+			}
+		}
+
+		MACRO_NODISCARD auto line_count() const noexcept -> std::uintmax_t { return m_starts.size(); }
+
+		MACRO_NODISCARD auto line(std::uintmax_t p_index) const noexcept -> line_t
+		{
+			line_t result;
+			if (p_index >= m_starts.size())
+			{
+				return result;
+			}
+
+			const std::uintmax_t start = m_starts[p_index];
+			std::uintmax_t stop = (p_index + 1 < m_starts.size()) ? m_starts[p_index + 1] : m_view->size();
+			const auto* base	= reinterpret_cast<const char*>(m_view->data());
+			if (stop > start && base[stop - 1] == '\n')
+			{
+				--stop;
+			}
+
+			result.m_data = base + start;
+			result.m_size = stop - start;
+			return result;
+		}
+
+		MACRO_NODISCARD auto line_offset(std::uintmax_t p_index) const noexcept -> std::uint64_t
+		{
+			return (p_index < m_starts.size()) ? m_starts[p_index] : m_view->size();
+		}
+
+		// Split the file into p_parts contiguous line ranges of near-equal line
+		// counts for parallel consumers
+		MACRO_NODISCARD auto partitions(std::uintmax_t p_parts) const -> std::vector<line_range_t>
+		{
+			std::vector<line_range_t> result;
+			if (p_parts == 0 || m_starts.empty())
+			{
+				return result;
+			}
+
+			const std::uintmax_t total = m_starts.size();
+			const std::uintmax_t parts = std::min(p_parts, total);
+			result.reserve(static_cast<std::size_t>(parts));
+
+			std::uintmax_t first = 0;
+			for (std::uintmax_t idx_for = 0; idx_for < parts; ++idx_for)
+			{
+				const std::uintmax_t count = (total / parts) + ((idx_for < total % parts) ? 1 : 0);
+				line_range_t range;
+				range.m_first = first;
+				range.m_count = count;
+				result.push_back(range);
+				first += count;
+			}
+			return result;
+		}
+	};
+
+	// Adaptive readahead helper for sequential scans over a file_view. The
+	// consumer publishes its position through set_cursor() (one relaxed atomic
+	// store, cheap enough for inner loops); a helper thread samples it, estimates
+	// the consumption rate and keeps madvise(MADV_WILLNEED) issued far enough
+	// ahead that the kernel readahead never lags the scan. Non-owning: the view
+	// must outlive the prefetcher.
+	class file_prefetcher
+	{
+	public:
+		using self_t = file_prefetcher;
+
+	private:
+		const file_view* m_view = nullptr;
+		std::atomic<std::uintmax_t> m_cursor;
+		std::atomic<bool> m_stop;
+		std::chrono::milliseconds m_interval;
+		std::uintmax_t m_min_ahead = 0;
+
+		std::mutex m_mutex;
+		std::condition_variable m_cv;
+		std::thread m_thread;
+
+	public:
+		~file_prefetcher() { stop(); }
+
+		explicit file_prefetcher(const file_view& p_view, std::uintmax_t p_min_ahead = mem_size::medium,
+								 std::chrono::milliseconds p_interval = std::chrono::milliseconds(10))
+			: m_view(&p_view), m_cursor(0), m_stop(false), m_interval(p_interval), m_min_ahead(p_min_ahead)
+		{
+			if (m_view->size() > 0 && m_view->data() != nullptr)
+			{
+				m_thread = std::thread([this]() { prefetch_loop(); });
+			}
+		}
+
+		file_prefetcher(const self_t&)			 = delete;
+		auto operator=(const self_t&) -> self_t& = delete;
+		file_prefetcher(self_t&&)				 = delete;
+		auto operator=(self_t&&) -> self_t&		 = delete;
+
+	public:
+		auto set_cursor(std::uintmax_t p_offset) noexcept -> void { m_cursor.store(p_offset, std::memory_order_relaxed); }
+
+		auto stop() noexcept -> void
+		{
+			m_stop.store(true, std::memory_order_release);
+			m_cv.notify_all();
+			if (m_thread.joinable())
+			{
+				m_thread.join();
+			}
+		}
+
+	private:
+		auto prefetch_loop() -> void
+		{
+			auto* base				  = const_cast<std::uint8_t*>(m_view->data());
+			const std::uintmax_t size = m_view->size();
+			const auto page_size	  = static_cast<std::uintmax_t>(::sysconf(_SC_PAGESIZE));
+
+			std::uintmax_t last_cursor = 0;
+			std::uintmax_t issued_to   = 0;
+
+			for (;;)
+			{
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					if (m_cv.wait_for(lock, m_interval, [this]() { return m_stop.load(std::memory_order_acquire); }))
+					{
+						return;
+					}
+				}
+
+				const std::uintmax_t cursor = std::min(m_cursor.load(std::memory_order_relaxed), size);
+				if (cursor < last_cursor)
+				{
+					// Consumer rewound; restart the window from the new position
+					issued_to = cursor;
+				}
+
+				// Keep roughly four sampling intervals of runway at the observed
+				// rate, never less than the configured floor
+				const std::uintmax_t rate  = cursor - std::min(last_cursor, cursor);
+				std::uintmax_t ahead	   = std::max(m_min_ahead, rate * 4);
+				ahead					   = std::min<std::uintmax_t>(ahead, mem_size::large);
+				const std::uintmax_t target = std::min(cursor + ahead, size);
+
+				if (target > issued_to)
+				{
+					const std::uintmax_t start = (std::max(issued_to, cursor) / page_size) * page_size;
+					if (target > start)
+					{
+						::madvise(base + start, static_cast<std::size_t>(target - start), MADV_WILLNEED);
+					}
+					issued_to = target;
+				}
+
+				last_cursor = cursor;
+			}
+		}
+	};
+
+	// Streaming counterpart to file_view for scans that must not pull the whole
+	// file into the page cache: only one chunk is mapped at a time, the window
+	// ahead of the cursor is prefetched with POSIX_FADV_WILLNEED and everything
+	// behind it is dropped with POSIX_FADV_DONTNEED, so resident memory stays at
+	// one chunk plus the readahead window regardless of file size. Single-pass:
+	// all iterators share the view's cursor.
+	class file_stream_view
+	{
+	public:
+		using self_t = file_stream_view;
+
+		struct chunk_t
+		{
+			const std::uint8_t* m_data = nullptr;
+			std::uintmax_t m_size	   = 0;
+			std::uintmax_t m_offset	   = 0;
+			std::uintmax_t m_index	   = 0;
+
+			MACRO_NODISCARD auto data() const noexcept -> const std::uint8_t* { return m_data; }
+
+			MACRO_NODISCARD auto size() const noexcept -> std::uintmax_t { return m_size; }
+
+			MACRO_NODISCARD auto offset() const noexcept -> std::uintmax_t { return m_offset; }
+
+			MACRO_NODISCARD auto index() const noexcept -> std::uintmax_t { return m_index; }
+
+			MACRO_NODISCARD auto begin() const noexcept -> const std::uint8_t* { return m_data; }
+
+			MACRO_NODISCARD auto end() const noexcept -> const std::uint8_t* { return m_data + m_size; }
+		};
+
+		class chunk_iterator
+		{
+		public:
+			using self_t			= chunk_iterator;
+			using value_type		= chunk_t;
+			using reference			= chunk_t;
+			using pointer			= const chunk_t*;
+			using difference_type	= std::ptrdiff_t;
+			using iterator_category = std::input_iterator_tag;
+
+		private:
+			file_stream_view* m_view = nullptr;
+			std::uintmax_t m_index	 = 0;
+
+		public:
+			chunk_iterator() noexcept = default;
+
+			chunk_iterator(file_stream_view* p_view, std::uintmax_t p_index) : m_view(p_view), m_index(p_index)
+			{
+				if (m_view != nullptr && m_index < m_view->chunk_count())
+				{
+					m_view->activate(m_index);
+				}
+			}
+
+			auto operator*() const -> chunk_t { return m_view->active_chunk(); }
+
+			auto operator++() -> self_t&
+			{
+				++m_index;
+				if (m_index < m_view->chunk_count())
+				{
+					m_view->activate(m_index);
+				}
+				else
+				{
+					m_view->release_active();
+				}
+				return *this;
+			}
+
+			friend auto operator==(const self_t& p_lhs, const self_t& p_rhs) noexcept -> bool { return p_lhs.m_index == p_rhs.m_index; }
+
+			friend auto operator!=(const self_t& p_lhs, const self_t& p_rhs) noexcept -> bool { return !(p_lhs == p_rhs); }
+		};
+
+	private:
+		fs::path m_path;
+
+		std::int32_t m_file_descriptor = -1;
+		std::uintmax_t m_file_size	   = 0;
+		std::uintmax_t m_chunk_size	   = 0;
+		std::uintmax_t m_window_chunks = 0;
+
+		void* m_active_map			  = MAP_FAILED;
+		std::uintmax_t m_active_size  = 0;
+		std::uintmax_t m_active_index = 0;
+
+	public:
+		~file_stream_view()
+		{
+			release_active();
+			if (m_file_descriptor >= 0)
+			{
+				::close(m_file_descriptor);
+				m_file_descriptor = -1;
+			}
+		}
+
+		explicit file_stream_view(fs::path p_path, std::uintmax_t p_chunk_size = mem_size::medium, std::uintmax_t p_window_chunks = 4)
+			: m_path(std::move(p_path)), m_chunk_size(p_chunk_size), m_window_chunks(p_window_chunks)
+		{
+			const auto page_size = static_cast<std::uintmax_t>(::sysconf(_SC_PAGESIZE));
+			m_chunk_size		 = ((m_chunk_size + page_size - 1) / page_size) * page_size;
+			if (m_window_chunks == 0)
+			{
+				m_window_chunks = 1;
+			}
+
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+			m_file_descriptor = ::open(m_path.c_str(), O_RDONLY | O_CLOEXEC);
+			if (m_file_descriptor < 0)
+			{
+				MACRO_THROW(std::runtime_error(std::format("Failed to open file '{}': {}", m_path.string(), ::strerror(errno))));
+			}
+
+			struct stat file_stat = {};
+			std::memset(&file_stat, 0, sizeof(file_stat));
+			if (::fstat(m_file_descriptor, &file_stat) < 0)
+			{
+				::close(m_file_descriptor);
+				m_file_descriptor = -1;
+				MACRO_THROW(std::runtime_error(std::format("Failed to get file status for '{}': {}", m_path.string(), ::strerror(errno))));
+			}
+
+			m_file_size = static_cast<std::uintmax_t>(file_stat.st_size);
+			::posix_fadvise(m_file_descriptor, 0, static_cast<off_t>(std::min(m_file_size, m_chunk_size * m_window_chunks)), POSIX_FADV_SEQUENTIAL);
+		}
+
+		file_stream_view(const self_t&)			 = delete;
+		auto operator=(const self_t&) -> self_t& = delete;
+
+		file_stream_view(self_t&& p_other) noexcept
+			: m_path(std::move(p_other.m_path)),
+			  m_file_descriptor(p_other.m_file_descriptor),
+			  m_file_size(p_other.m_file_size),
+			  m_chunk_size(p_other.m_chunk_size),
+			  m_window_chunks(p_other.m_window_chunks),
+			  m_active_map(p_other.m_active_map),
+			  m_active_size(p_other.m_active_size),
+			  m_active_index(p_other.m_active_index)
+		{
+			p_other.m_file_descriptor = -1;
+			p_other.m_active_map	  = MAP_FAILED;
+			p_other.m_active_size	  = 0;
+			p_other.m_file_size		  = 0;
+		}
+
+		auto operator=(self_t&& p_other) noexcept -> self_t&
+		{
+			if (this != &p_other)
+			{
+				release_active();
+				if (m_file_descriptor >= 0)
+				{
+					::close(m_file_descriptor);
+				}
+
+				m_path			  = std::move(p_other.m_path);
+				m_file_descriptor = p_other.m_file_descriptor;
+				m_file_size		  = p_other.m_file_size;
+				m_chunk_size	  = p_other.m_chunk_size;
+				m_window_chunks	  = p_other.m_window_chunks;
+				m_active_map	  = p_other.m_active_map;
+				m_active_size	  = p_other.m_active_size;
+				m_active_index	  = p_other.m_active_index;
+
+				p_other.m_file_descriptor = -1;
+				p_other.m_active_map	  = MAP_FAILED;
+				p_other.m_active_size	  = 0;
+				p_other.m_file_size		  = 0;
+			}
+			return *this;
+		}
+
+	public:
+		MACRO_NODISCARD auto is_open() const noexcept -> bool { return m_file_descriptor >= 0; }
+
+		MACRO_NODISCARD auto size() const noexcept -> std::uintmax_t { return m_file_size; }
+
+		MACRO_NODISCARD auto chunk_size() const noexcept -> std::uintmax_t { return m_chunk_size; }
+
+		MACRO_NODISCARD auto chunk_count() const noexcept -> std::uintmax_t { return (m_file_size + m_chunk_size - 1) / m_chunk_size; }
+
+		MACRO_NODISCARD auto begin() -> chunk_iterator { return chunk_iterator(this, 0); }
+
+		MACRO_NODISCARD auto end() -> chunk_iterator { return chunk_iterator(nullptr, chunk_count()); }
+
+	private:
+		friend class chunk_iterator;
+
+		auto activate(std::uintmax_t p_index) -> void
+		{
+			if (m_active_map != MAP_FAILED && m_active_index == p_index)
+			{
+				return;
+			}
+
+			const std::uintmax_t behind_offset = (m_active_map != MAP_FAILED) ? m_active_index * m_chunk_size : 0;
+			const std::uintmax_t behind_size   = m_active_size;
+			release_active();
+			if (behind_size > 0)
+			{
+				::posix_fadvise(m_file_descriptor, static_cast<off_t>(behind_offset), static_cast<off_t>(behind_size), POSIX_FADV_DONTNEED);
+			}
+
+			const std::uintmax_t offset = p_index * m_chunk_size;
+			const std::uintmax_t length = std::min(m_chunk_size, m_file_size - offset);
+
+			void* map = ::mmap(nullptr, static_cast<std::size_t>(length), PROT_READ, MAP_PRIVATE, m_file_descriptor, static_cast<off_t>(offset));
+			if (map == MAP_FAILED)
+			{
+				MACRO_THROW(std::runtime_error(std::format("Failed to map chunk {} of file '{}': {}", p_index, m_path.string(), ::strerror(errno))));
+			}
+
+			m_active_map   = map;
+			m_active_size  = length;
+			m_active_index = p_index;
+			::madvise(m_active_map, static_cast<std::size_t>(m_active_size), MADV_SEQUENTIAL);
+
+			const std::uintmax_t ahead_offset = offset + length;
+			if (ahead_offset < m_file_size)
+			{
+				const std::uintmax_t ahead_size = std::min(m_chunk_size * m_window_chunks, m_file_size - ahead_offset);
+				::posix_fadvise(m_file_descriptor, static_cast<off_t>(ahead_offset), static_cast<off_t>(ahead_size), POSIX_FADV_WILLNEED);
+			}
+		}
+
+		auto release_active() noexcept -> void
+		{
+			if (m_active_map != MAP_FAILED)
+			{
+				::munmap(m_active_map, static_cast<std::size_t>(m_active_size));
+				m_active_map  = MAP_FAILED;
+				m_active_size = 0;
+			}
+		}
+
+		auto active_chunk() const noexcept -> chunk_t
+		{
+			chunk_t chunk;
+			chunk.m_data   = static_cast<const std::uint8_t*>(m_active_map);
+			chunk.m_size   = m_active_size;
+			chunk.m_offset = m_active_index * m_chunk_size;
+			chunk.m_index  = m_active_index;
+			return chunk;
+		}
+	};
 }	 // namespace utils
 #endif	  // FILE_VIEW_HPP
@@ -0,0 +1,565 @@
+#pragma once
+#ifndef FLAT_HASH_MAP_HPP
+	#define FLAT_HASH_MAP_HPP
+
+	#include <cassert>
+	#include <cstddef>
+	#include <cstdint>
+	#include <cstring>
+	#include <functional>
+	#include <memory>
+	#include <new>
+	#include <stdexcept>
+	#include <string>
+	#include <type_traits>
+	#include <utility>
+
+	#if defined(__SSE2__)
+		#include <emmintrin.h>
+	#endif
+
+	#include "std/string_view.hpp"	  // IWYU pragma: keep
+	#include "utils_macros.hpp"
+
+namespace utils
+{
+	/**
+	 * @brief Default hash for flat_hash_map with heterogeneous string support
+	 *
+	 * Primary template defers to std::hash. The string specializations all
+	 * hash the character sequence with FNV-1a, so std::string, string_view
+	 * and const char* keys produce identical hashes and can be used
+	 * interchangeably for lookups without constructing a std::string.
+	 */
+	template <typename key_t> struct flat_hash
+	{
+		auto operator()(const key_t& p_key) const -> std::size_t { return std::hash<key_t>()(p_key); }
+	};
+
+	namespace flat_detail
+	{
+		inline auto hash_bytes(const char* p_data, std::size_t p_size) -> std::size_t
+		{
+			std::size_t hash = static_cast<std::size_t>(1469598103934665603ULL);
+			for (std::size_t idx_for = 0; idx_for < p_size; ++idx_for)
+			{
+				hash ^= static_cast<unsigned char>(p_data[idx_for]);
+				hash *= static_cast<std::size_t>(1099511628211ULL);
+			}
+			return hash;
+		}
+	}	 // namespace flat_detail
+
+	template <> struct flat_hash<std::string>
+	{
+		// Marks the hash as transparent so lookups accept any string-like key
+		using is_transparent = void;
+
+		auto operator()(const std::string& p_key) const -> std::size_t { return flat_detail::hash_bytes(p_key.data(), p_key.size()); }
+
+		auto operator()(const std::string_view& p_key) const -> std::size_t { return flat_detail::hash_bytes(p_key.data(), p_key.size()); }
+
+		auto operator()(const char* p_key) const -> std::size_t { return flat_detail::hash_bytes(p_key, std::strlen(p_key)); }
+	};
+
+	/**
+	 * @brief Default key equality with heterogeneous string support
+	 */
+	template <typename key_t> struct flat_key_equal
+	{
+		template <typename lhs_t, typename rhs_t> auto operator()(const lhs_t& p_lhs, const rhs_t& p_rhs) const -> bool { return p_lhs == p_rhs; }
+	};
+
+	/**
+	 * @brief Open-addressing hash map with contiguous storage
+	 *
+	 * Swiss-table style layout: one control byte per slot holding either a
+	 * sentinel (empty/deleted) or the low 7 bits of the key's hash, probed a
+	 * 16-byte group at a time (SSE2 when available, word-at-a-time scalar
+	 * fallback otherwise), with the key/value pairs in a parallel contiguous
+	 * array. Lookups touch one cache line of control bytes to reject 16
+	 * candidates at once, which is what makes this a drop-in upgrade for the
+	 * std::map registries on lookup-heavy paths. Works down to C++11.
+	 *
+	 * Iteration order is unspecified and iterators are invalidated by rehash
+	 * (insert may rehash; erase never does).
+	 */
+	template <typename key_t, typename mapped_t, typename hash_t = flat_hash<key_t>, typename key_equal_t = flat_key_equal<key_t> > class flat_hash_map
+	{
+	public:
+		using self_t	  = flat_hash_map<key_t, mapped_t, hash_t, key_equal_t>;
+		using key_type	  = key_t;
+		using mapped_type = mapped_t;
+		using value_type  = std::pair<key_t, mapped_t>;
+		using size_type	  = std::size_t;
+
+	private:
+		// Control byte values: empty and deleted have the sign bit set so a
+		// group can reject both classes with one mask; full slots store the
+		// low 7 bits of the hash (sign bit clear)
+		static const std::uint8_t k_ctrl_empty	 = 0x80;
+		static const std::uint8_t k_ctrl_deleted = 0xFE;
+		static const size_type k_group_size		 = 16;
+		static const size_type k_min_capacity	 = 16;
+
+		std::unique_ptr<std::uint8_t[]> m_ctrl;
+		std::unique_ptr<unsigned char[]> m_slots;
+		size_type m_capacity;
+		size_type m_size;
+		size_type m_used;	 // full + deleted slots, drives the rehash threshold
+		hash_t m_hash;
+		key_equal_t m_equal;
+
+	public:
+		class iterator
+		{
+		public:
+			using self_t = iterator;
+
+		private:
+			const std::uint8_t* m_ctrl;
+			value_type* m_slot;
+			const std::uint8_t* m_ctrl_end;
+
+			friend class flat_hash_map;
+
+			iterator(const std::uint8_t* p_ctrl, value_type* p_slot, const std::uint8_t* p_ctrl_end) : m_ctrl(p_ctrl), m_slot(p_slot), m_ctrl_end(p_ctrl_end)
+			{
+				skip_holes();
+			}
+
+			auto skip_holes() -> void
+			{
+				while (m_ctrl != m_ctrl_end && (*m_ctrl & 0x80) != 0)
+				{
+					++m_ctrl;
+					++m_slot;
+				}
+			}
+
+		public:
+			auto operator*() const -> value_type& { return *m_slot; }
+
+			auto operator->() const -> value_type* { return m_slot; }
+
+			auto operator++() -> self_t&
+			{
+				++m_ctrl;
+				++m_slot;
+				skip_holes();
+				return *this;
+			}
+
+			auto operator==(const self_t& p_other) const -> bool { return m_ctrl == p_other.m_ctrl; }
+
+			auto operator!=(const self_t& p_other) const -> bool { return m_ctrl != p_other.m_ctrl; }
+		};
+
+		using const_iterator = iterator;
+
+	public:
+		~flat_hash_map() { destroy_all(); }
+
+		flat_hash_map() : m_capacity(0), m_size(0), m_used(0) {}
+
+		explicit flat_hash_map(size_type p_initial_capacity) : m_capacity(0), m_size(0), m_used(0) { reserve(p_initial_capacity); }
+
+		flat_hash_map(const self_t& p_other) : m_capacity(0), m_size(0), m_used(0)
+		{
+			reserve(p_other.m_size);
+			for (const std::uint8_t* ctrl = p_other.m_ctrl.get(); ctrl != p_other.m_ctrl.get() + p_other.m_capacity; ++ctrl)
+			{
+				if ((*ctrl & 0x80) == 0)
+				{
+					const value_type& slot = p_other.slot_at(static_cast<size_type>(ctrl - p_other.m_ctrl.get()));
+					insert(slot);
+				}
+			}
+		}
+
+		auto operator=(const self_t& p_other) -> self_t&
+		{
+			if (this != &p_other)
+			{
+				self_t copy(p_other);
+				swap_with(copy);
+			}
+			return *this;
+		}
+
+		flat_hash_map(self_t&& p_other) noexcept
+			: m_ctrl(std::move(p_other.m_ctrl)),
+			  m_slots(std::move(p_other.m_slots)),
+			  m_capacity(p_other.m_capacity),
+			  m_size(p_other.m_size),
+			  m_used(p_other.m_used),
+			  m_hash(std::move(p_other.m_hash)),
+			  m_equal(std::move(p_other.m_equal))
+		{
+			p_other.m_capacity = 0;
+			p_other.m_size	   = 0;
+			p_other.m_used	   = 0;
+		}
+
+		auto operator=(self_t&& p_other) noexcept -> self_t&
+		{
+			if (this != &p_other)
+			{
+				destroy_all();
+				m_ctrl			   = std::move(p_other.m_ctrl);
+				m_slots			   = std::move(p_other.m_slots);
+				m_capacity		   = p_other.m_capacity;
+				m_size			   = p_other.m_size;
+				m_used			   = p_other.m_used;
+				m_hash			   = std::move(p_other.m_hash);
+				m_equal			   = std::move(p_other.m_equal);
+				p_other.m_capacity = 0;
+				p_other.m_size	   = 0;
+				p_other.m_used	   = 0;
+			}
+			return *this;
+		}
+
+	public:
+		MACRO_NODISCARD auto size() const noexcept -> size_type { return m_size; }
+
+		MACRO_NODISCARD auto empty() const noexcept -> bool { return m_size == 0; }
+
+		MACRO_NODISCARD auto capacity() const noexcept -> size_type { return m_capacity; }
+
+		auto begin() -> iterator { return iterator(m_ctrl.get(), slots(), m_ctrl.get() + m_capacity); }
+
+		auto begin() const -> const_iterator { return const_iterator(m_ctrl.get(), const_cast<self_t*>(this)->slots(), m_ctrl.get() + m_capacity); }
+
+		auto end() -> iterator { return iterator(m_ctrl.get() + m_capacity, slots() + m_capacity, m_ctrl.get() + m_capacity); }
+
+		auto end() const -> const_iterator
+		{
+			return const_iterator(m_ctrl.get() + m_capacity, const_cast<self_t*>(this)->slots() + m_capacity, m_ctrl.get() + m_capacity);
+		}
+
+		// Grows so that p_count elements fit without rehashing (7/8 load cap)
+		auto reserve(size_type p_count) -> void
+		{
+			size_type needed = k_min_capacity;
+			while (needed - (needed / 8) < p_count)
+			{
+				needed *= 2;
+			}
+			if (needed > m_capacity)
+			{
+				rehash_to(needed);
+			}
+		}
+
+		auto clear() -> void
+		{
+			destroy_elements();
+			if (m_capacity > 0)
+			{
+				std::memset(m_ctrl.get(), k_ctrl_empty, m_capacity);
+			}
+			m_size = 0;
+			m_used = 0;
+		}
+
+		// Inserts or assigns; returns a reference to the stored mapped value
+		auto operator[](const key_t& p_key) -> mapped_t&
+		{
+			const std::size_t hash = m_hash(p_key);
+			size_type slot_index   = 0;
+			if (find_slot(p_key, hash, slot_index))
+			{
+				return slot_at(slot_index).second;
+			}
+			slot_index = insert_new(p_key, hash);
+			return slot_at(slot_index).second;
+		}
+
+		auto insert(const value_type& p_pair) -> std::pair<iterator, bool>
+		{
+			const std::size_t hash = m_hash(p_pair.first);
+			size_type slot_index   = 0;
+			if (find_slot(p_pair.first, hash, slot_index))
+			{
+				return std::pair<iterator, bool>(make_iterator(slot_index), false);
+			}
+			slot_index = insert_new(p_pair.first, hash);
+			slot_at(slot_index).second = p_pair.second;
+			return std::pair<iterator, bool>(make_iterator(slot_index), true);
+		}
+
+		template <typename key2_t, typename... args_t> auto emplace(key2_t&& p_key, args_t&&... p_args) -> std::pair<iterator, bool>
+		{
+			const std::size_t hash = m_hash(p_key);
+			size_type slot_index   = 0;
+			if (find_slot(p_key, hash, slot_index))
+			{
+				return std::pair<iterator, bool>(make_iterator(slot_index), false);
+			}
+			maybe_grow();
+			slot_index = probe_insert_position(hash);
+			new (&slot_at(slot_index)) value_type(key_t(std::forward<key2_t>(p_key)), mapped_t(std::forward<args_t>(p_args)...));
+			commit_slot(slot_index, hash);
+			return std::pair<iterator, bool>(make_iterator(slot_index), true);
+		}
+
+		// Heterogeneous find: any key the hash and equality accept (e.g.
+		// string_view or const char* against std::string keys)
+		template <typename lookup_t> auto find(const lookup_t& p_key) -> iterator
+		{
+			if (m_capacity == 0)
+			{
+				return end();
+			}
+			size_type slot_index = 0;
+			if (find_slot(p_key, m_hash(p_key), slot_index))
+			{
+				return make_iterator(slot_index);
+			}
+			return end();
+		}
+
+		template <typename lookup_t> auto find(const lookup_t& p_key) const -> const_iterator { return const_cast<self_t*>(this)->find(p_key); }
+
+		template <typename lookup_t> MACRO_NODISCARD auto contains(const lookup_t& p_key) const -> bool
+		{
+			return const_cast<self_t*>(this)->find(p_key) != const_cast<self_t*>(this)->end();
+		}
+
+		template <typename lookup_t> auto at(const lookup_t& p_key) -> mapped_t&
+		{
+			iterator it = find(p_key);
+			if (it == end())
+			{
+				throw std::out_of_range("flat_hash_map::at: key not found");
+			}
+			return it->second;
+		}
+
+		template <typename lookup_t> auto at(const lookup_t& p_key) const -> const mapped_t& { return const_cast<self_t*>(this)->at(p_key); }
+
+		// Tombstone erase: the slot becomes deleted and is reused by later
+		// inserts; no rehash, iterators to other elements stay valid
+		template <typename lookup_t> auto erase(const lookup_t& p_key) -> size_type
+		{
+			if (m_capacity == 0)
+			{
+				return 0;
+			}
+			size_type slot_index = 0;
+			if (!find_slot(p_key, m_hash(p_key), slot_index))
+			{
+				return 0;
+			}
+			slot_at(slot_index).~value_type();
+			m_ctrl[slot_index] = k_ctrl_deleted;
+			--m_size;
+			return 1;
+		}
+
+	private:
+		auto slots() -> value_type* { return reinterpret_cast<value_type*>(m_slots.get()); }
+
+		auto slot_at(size_type p_index) -> value_type& { return slots()[p_index]; }
+
+		auto slot_at(size_type p_index) const -> const value_type& { return reinterpret_cast<const value_type*>(m_slots.get())[p_index]; }
+
+		auto make_iterator(size_type p_index) -> iterator
+		{
+			return iterator(m_ctrl.get() + p_index, slots() + p_index, m_ctrl.get() + m_capacity);
+		}
+
+		static auto hash_fragment(std::size_t p_hash) -> std::uint8_t { return static_cast<std::uint8_t>(p_hash & 0x7F); }
+
+		static auto hash_position(std::size_t p_hash, size_type p_capacity) -> size_type
+		{
+			// Group-aligned start so each probe step scans one full group
+			return ((p_hash >> 7) & (p_capacity - 1)) & ~(k_group_size - 1);
+		}
+
+		// Scans one 16-byte control group: returns a bitmask of slots whose
+		// fragment matches, and reports whether the group holds any empty
+		// slot (which terminates the probe sequence)
+		static auto probe_group(const std::uint8_t* p_group, std::uint8_t p_fragment, std::uint32_t& p_match_mask, bool& p_has_empty) -> void
+		{
+	#if defined(__SSE2__)
+			const __m128i group	   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_group));
+			const __m128i fragment = _mm_set1_epi8(static_cast<char>(p_fragment));
+			const __m128i empty	   = _mm_set1_epi8(static_cast<char>(k_ctrl_empty));
+			p_match_mask		   = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, fragment)));
+			p_has_empty			   = _mm_movemask_epi8(_mm_cmpeq_epi8(group, empty)) != 0;
+	#else
+			p_match_mask = 0;
+			p_has_empty	 = false;
+			for (size_type idx_for = 0; idx_for < k_group_size; ++idx_for)
+			{
+				if (p_group[idx_for] == p_fragment)
+				{
+					p_match_mask |= (1U << idx_for);
+				}
+				else if (p_group[idx_for] == k_ctrl_empty)
+				{
+					p_has_empty = true;
+				}
+			}
+	#endif
+		}
+
+		// Finds the slot holding p_key; false if absent. Probes group by
+		// group, stopping at the first group containing an empty slot.
+		template <typename lookup_t> auto find_slot(const lookup_t& p_key, std::size_t p_hash, size_type& p_slot_index) -> bool
+		{
+			if (m_capacity == 0)
+			{
+				return false;
+			}
+
+			const std::uint8_t fragment = hash_fragment(p_hash);
+			size_type group_start		= hash_position(p_hash, m_capacity);
+
+			for (size_type probes = 0; probes < m_capacity; probes += k_group_size)
+			{
+				std::uint32_t match_mask = 0;
+				bool has_empty			 = false;
+				probe_group(m_ctrl.get() + group_start, fragment, match_mask, has_empty);
+
+				while (match_mask != 0)
+				{
+					const size_type bit	 = static_cast<size_type>(__builtin_ctz(match_mask));
+					const size_type slot = group_start + bit;
+					if (m_equal(slot_at(slot).first, p_key))
+					{
+						p_slot_index = slot;
+						return true;
+					}
+					match_mask &= match_mask - 1;
+				}
+
+				if (has_empty)
+				{
+					return false;
+				}
+
+				group_start = (group_start + k_group_size) & (m_capacity - 1);
+			}
+			return false;
+		}
+
+		// First empty or deleted slot along p_hash's probe sequence
+		auto probe_insert_position(std::size_t p_hash) const -> size_type
+		{
+			size_type group_start = hash_position(p_hash, m_capacity);
+			for (;;)
+			{
+				for (size_type idx_for = 0; idx_for < k_group_size; ++idx_for)
+				{
+					const size_type slot = group_start + idx_for;
+					if ((m_ctrl[slot] & 0x80) != 0)
+					{
+						return slot;
+					}
+				}
+				group_start = (group_start + k_group_size) & (m_capacity - 1);
+			}
+		}
+
+		auto commit_slot(size_type p_slot_index, std::size_t p_hash) -> void
+		{
+			if (m_ctrl[p_slot_index] == k_ctrl_empty)
+			{
+				++m_used;
+			}
+			m_ctrl[p_slot_index] = hash_fragment(p_hash);
+			++m_size;
+		}
+
+		auto insert_new(const key_t& p_key, std::size_t p_hash) -> size_type
+		{
+			maybe_grow();
+			const size_type slot_index = probe_insert_position(p_hash);
+			new (&slot_at(slot_index)) value_type(p_key, mapped_t());
+			commit_slot(slot_index, p_hash);
+			return slot_index;
+		}
+
+		auto maybe_grow() -> void
+		{
+			if (m_capacity == 0)
+			{
+				rehash_to(k_min_capacity);
+				return;
+			}
+			// 7/8 load factor on used (full + deleted) slots
+			if ((m_used + 1) > m_capacity - (m_capacity / 8))
+			{
+				// Tombstone-heavy tables rehash in place instead of doubling
+				const size_type target = (m_size >= m_capacity / 2) ? m_capacity * 2 : m_capacity;
+				rehash_to(target);
+			}
+		}
+
+		auto rehash_to(size_type p_new_capacity) -> void
+		{
+			std::unique_ptr<std::uint8_t[]> old_ctrl   = std::move(m_ctrl);
+			std::unique_ptr<unsigned char[]> old_slots = std::move(m_slots);
+			const size_type old_capacity			   = m_capacity;
+
+			m_ctrl.reset(new std::uint8_t[p_new_capacity]);
+			m_slots.reset(new unsigned char[p_new_capacity * sizeof(value_type) + alignof(value_type)]);
+			std::memset(m_ctrl.get(), k_ctrl_empty, p_new_capacity);
+			m_capacity = p_new_capacity;
+			m_size	   = 0;
+			m_used	   = 0;
+
+			value_type* old_pairs = reinterpret_cast<value_type*>(old_slots.get());
+			for (size_type idx_for = 0; idx_for < old_capacity; ++idx_for)
+			{
+				if ((old_ctrl[idx_for] & 0x80) == 0)
+				{
+					value_type& old_pair	   = old_pairs[idx_for];
+					const std::size_t hash	   = m_hash(old_pair.first);
+					const size_type slot_index = probe_insert_position(hash);
+					new (&slot_at(slot_index)) value_type(std::move(old_pair));
+					commit_slot(slot_index, hash);
+					old_pair.~value_type();
+				}
+			}
+		}
+
+		auto destroy_elements() -> void
+		{
+			if (m_capacity == 0)
+			{
+				return;
+			}
+			for (size_type idx_for = 0; idx_for < m_capacity; ++idx_for)
+			{
+				if ((m_ctrl[idx_for] & 0x80) == 0)
+				{
+					slot_at(idx_for).~value_type();
+				}
+			}
+		}
+
+		auto destroy_all() -> void
+		{
+			destroy_elements();
+			m_size = 0;
+			m_used = 0;
+		}
+
+		auto swap_with(self_t& p_other) -> void
+		{
+			std::swap(m_ctrl, p_other.m_ctrl);
+			std::swap(m_slots, p_other.m_slots);
+			std::swap(m_capacity, p_other.m_capacity);
+			std::swap(m_size, p_other.m_size);
+			std::swap(m_used, p_other.m_used);
+			std::swap(m_hash, p_other.m_hash);
+			std::swap(m_equal, p_other.m_equal);
+		}
+	};
+}	 // namespace utils
+
+#endif	  // FLAT_HASH_MAP_HPP
@@ -4,10 +4,11 @@
 #ifndef GUID_GENERATOR_HPP
 	#define GUID_GENERATOR_HPP
 
-	#include <atomic>
 	#include <cstdint>
 	#include <random>
 
+	#include "cspan.hpp"
+
 namespace utils
 {
 	class guid_generator
@@ -20,39 +21,48 @@ namespace utils
 		};
 
 	private:
-		static auto get_counter() -> std::atomic<std::uint32_t>&
-		{
-			static std::atomic<std::uint32_t> instance{1};
-			return instance;
-		}
-
-		static auto get_random_device() -> std::random_device&
+		// Per-thread engine and counter, seeded once from random_device on the
+		// thread's first use: generation never shares state across threads, so
+		// there are no locks, no atomic traffic and no data race on the engine
+		struct thread_state
 		{
-			static std::random_device instance{};
-			return instance;
-		}
+			std::mt19937 engine;
+			std::uniform_int_distribution<std::uint32_t> distribution;
+			std::uint32_t counter;
 
-		static auto get_generator() -> std::mt19937&
-		{
-			static std::mt19937 instance{get_random_device()()};
-			return instance;
-		}
+			thread_state() : engine(std::random_device{}()), distribution(), counter(1) {}
+		};
 
-		static auto get_distribution() -> std::uniform_int_distribution<std::uint32_t>&
+		static auto get_thread_state() -> thread_state&
 		{
-			static std::uniform_int_distribution<std::uint32_t> instance{};
-			return instance;
+			static thread_local thread_state state;
+			return state;
 		}
 
 	public:
 		static auto generate() -> std::uint32_t
 		{
-			std::uint32_t counter_part = get_counter().fetch_add(1) & constants::COUNTER_BITS;
-			std::uint32_t random_part  = get_distribution()(get_generator()) & constants::RANDOM_BITS;
+			thread_state& state		   = get_thread_state();
+			std::uint32_t counter_part = state.counter++ & constants::COUNTER_BITS;
+			std::uint32_t random_part  = state.distribution(state.engine) & constants::RANDOM_BITS;
 			return counter_part | random_part;
 		}
 
-		static auto reset_counter() -> void { get_counter().store(0); }
+		// Fills a whole block of ids in one call for bulk-insert paths; the
+		// thread state is resolved once instead of per id
+		static auto generate_batch(cspan<std::uint32_t> p_out) -> void
+		{
+			thread_state& state = get_thread_state();
+			for (std::size_t idx_for = 0; idx_for < p_out.size(); ++idx_for)
+			{
+				const std::uint32_t counter_part = state.counter++ & constants::COUNTER_BITS;
+				const std::uint32_t random_part	 = state.distribution(state.engine) & constants::RANDOM_BITS;
+				p_out[idx_for]					 = counter_part | random_part;
+			}
+		}
+
+		// Resets the calling thread's counter; other threads are unaffected
+		static auto reset_counter() -> void { get_thread_state().counter = 0; }
 	};
 }	 // namespace utils
 
@@ -30,12 +30,23 @@
 
 	#define SPDLOG_HEADER_ONLY
 
+	#include <atomic>
+	#include <chrono>
+	#include <cstdint>
+	#include <cstring>
+	#include <map>
+	#include <thread>
+	#include <utility>
+	#include <vector>
+
+	#include <fmt/args.h>
 	#include <spdlog/logger.h>
 	#include <spdlog/sinks/basic_file_sink.h>
 	#include <spdlog/sinks/stdout_color_sinks.h>
 	#include <spdlog/spdlog.h>
 
 	#include "cmemory.hpp"			  // IWYU pragma: keep
+	#include "file.hpp"
 	#include "std/string_view.hpp"	  // IWYU pragma: keep
 
 	#define UNIQUE_PTR_LOGGER std::unique_ptr<utils::logger>
@@ -44,16 +55,470 @@
 
 namespace utils
 {
+	namespace logger_detail
+	{
+		// What to do when the async ring is full: lose the message (counted) or
+		// spin until the consumer frees a slot.
+		enum class async_full_policy : std::uint8_t
+		{
+			drop,
+			block
+		};
+
+		// Argument bytes a record can carry; larger packs fall back to the
+		// synchronous path at compile time.
+		const std::size_t k_record_payload = 88;
+
+		// Copyable part of a ring slot: everything needed to format the
+		// message later on the consumer thread.
+		struct record_data
+		{
+			using format_fn_t = auto (*)(spdlog::logger&, spdlog::level::level_enum, spdlog::string_view_t, const unsigned char*) -> void;
+
+			format_fn_t m_format;
+			const char* m_fmt_data;
+			std::size_t m_fmt_size;
+			spdlog::level::level_enum m_level;
+			unsigned char m_payload[k_record_payload];
+		};
+
+		struct log_record
+		{
+			std::atomic<std::size_t> m_sequence;
+			record_data m_data;
+		};
+
+		template <typename... args_t> struct payload_size;
+
+		template <> struct payload_size<>
+		{
+			static const std::size_t value = 0;
+		};
+
+		template <typename head_t, typename... tail_t> struct payload_size<head_t, tail_t...>
+		{
+			static const std::size_t value = sizeof(head_t) + payload_size<tail_t...>::value;
+		};
+
+		template <typename... args_t> struct async_eligible;
+
+		template <> struct async_eligible<>
+		{
+			static const bool value = true;
+		};
+
+		template <typename head_t, typename... tail_t> struct async_eligible<head_t, tail_t...>
+		{
+			static const bool value = std::is_trivially_copyable<head_t>::value && async_eligible<tail_t...>::value;
+		};
+
+		// Serializes an argument pack into a byte buffer and replays it later;
+		// memcpy both ways keeps unaligned slots well-defined.
+		template <typename... args_t> struct payload_codec;
+
+		template <> struct payload_codec<>
+		{
+			static auto encode(unsigned char*, std::size_t) -> void {}
+
+			template <typename... done_t>
+			static auto invoke(spdlog::logger& p_logger, spdlog::level::level_enum p_level, spdlog::string_view_t p_fmt, const unsigned char*, std::size_t,
+							   const done_t&... p_done) -> void
+			{
+				const std::string text = spdlog::fmt_lib::vformat(p_fmt, spdlog::fmt_lib::make_format_args(p_done...));
+				p_logger.log(p_level, spdlog::string_view_t(text.data(), text.size()));
+			}
+		};
+
+		template <typename head_t, typename... tail_t> struct payload_codec<head_t, tail_t...>
+		{
+			static auto encode(unsigned char* p_dst, std::size_t p_offset, const head_t& p_head, const tail_t&... p_tail) -> void
+			{
+				std::memcpy(p_dst + p_offset, &p_head, sizeof(head_t));
+				payload_codec<tail_t...>::encode(p_dst, p_offset + sizeof(head_t), p_tail...);
+			}
+
+			template <typename... done_t>
+			static auto invoke(spdlog::logger& p_logger, spdlog::level::level_enum p_level, spdlog::string_view_t p_fmt, const unsigned char* p_src,
+							   std::size_t p_offset, const done_t&... p_done) -> void
+			{
+				head_t value;
+				std::memcpy(&value, p_src + p_offset, sizeof(head_t));
+				payload_codec<tail_t...>::invoke(p_logger, p_level, p_fmt, p_src, p_offset + sizeof(head_t), p_done..., value);
+			}
+		};
+
+		template <typename... args_t>
+		auto format_record(spdlog::logger& p_logger, spdlog::level::level_enum p_level, spdlog::string_view_t p_fmt, const unsigned char* p_payload) -> void
+		{
+			payload_codec<args_t...>::invoke(p_logger, p_level, p_fmt, p_payload, 0);
+		}
+
+		// Bounded MPSC ring (Vyukov scheme): producers claim slots with a CAS
+		// on the enqueue cursor, the single consumer pops without contention.
+		class log_ring
+		{
+		public:
+			using self_t = log_ring;
+
+		private:
+			std::unique_ptr<log_record[]> m_slots;
+			std::size_t m_mask;
+			alignas(64) std::atomic<std::size_t> m_enqueue_pos;
+			alignas(64) std::atomic<std::size_t> m_dequeue_pos;
+
+		public:
+			explicit log_ring(std::size_t p_capacity) : m_slots(nullptr), m_mask(0), m_enqueue_pos(0), m_dequeue_pos(0)
+			{
+				std::size_t capacity = 2;
+				while (capacity < p_capacity)
+				{
+					capacity *= 2;
+				}
+				m_slots.reset(new log_record[capacity]);
+				m_mask = capacity - 1;
+				for (std::size_t idx_for = 0; idx_for < capacity; ++idx_for)
+				{
+					m_slots[idx_for].m_sequence.store(idx_for, std::memory_order_relaxed);
+				}
+			}
+
+			log_ring(const self_t&)					 = delete;
+			auto operator=(const self_t&) -> self_t& = delete;
+
+			template <typename... args_t>
+			auto try_push(spdlog::level::level_enum p_level, spdlog::string_view_t p_fmt, const args_t&... p_args) -> bool
+			{
+				std::size_t pos		= m_enqueue_pos.load(std::memory_order_relaxed);
+				log_record* slot	= nullptr;
+				for (;;)
+				{
+					slot					= &m_slots[pos & m_mask];
+					const std::size_t seq	= slot->m_sequence.load(std::memory_order_acquire);
+					const std::intptr_t dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+					if (dif == 0)
+					{
+						if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						{
+							break;
+						}
+					}
+					else if (dif < 0)
+					{
+						return false;
+					}
+					else
+					{
+						pos = m_enqueue_pos.load(std::memory_order_relaxed);
+					}
+				}
+
+				record_data& data = slot->m_data;
+				data.m_format	  = &format_record<args_t...>;
+				data.m_fmt_data	  = p_fmt.data();
+				data.m_fmt_size	  = p_fmt.size();
+				data.m_level	  = p_level;
+				payload_codec<args_t...>::encode(data.m_payload, 0, p_args...);
+				slot->m_sequence.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+
+			auto try_pop(record_data& p_out) -> bool
+			{
+				const std::size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+				log_record* slot	  = &m_slots[pos & m_mask];
+				const std::size_t seq = slot->m_sequence.load(std::memory_order_acquire);
+				if (seq != pos + 1)
+				{
+					return false;
+				}
+				p_out = slot->m_data;
+				m_dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+				slot->m_sequence.store(pos + m_mask + 1, std::memory_order_release);
+				return true;
+			}
+		};
+
+		// Owns the ring and the consumer thread; formatting and sink I/O run
+		// here instead of on the calling thread.
+		class async_engine
+		{
+		public:
+			using self_t = async_engine;
+
+		private:
+			log_ring m_ring;
+			std::shared_ptr<spdlog::logger> m_logger;
+			async_full_policy m_policy;
+			std::atomic<bool> m_running;
+			std::atomic<std::uint64_t> m_dropped;
+			std::thread m_worker;
+
+		public:
+			async_engine(std::shared_ptr<spdlog::logger> p_logger, std::size_t p_capacity, async_full_policy p_policy)
+				: m_ring(p_capacity), m_logger(std::move(p_logger)), m_policy(p_policy), m_running(true), m_dropped(0)
+			{
+				m_worker = std::thread(&self_t::run, this);
+			}
+
+			~async_engine() { stop(); }
+
+			async_engine(const self_t&)				 = delete;
+			auto operator=(const self_t&) -> self_t& = delete;
+
+			template <typename... args_t> auto push(spdlog::level::level_enum p_level, spdlog::string_view_t p_fmt, const args_t&... p_args) -> bool
+			{
+				if (m_ring.try_push(p_level, p_fmt, p_args...))
+				{
+					return true;
+				}
+				if (m_policy == async_full_policy::block)
+				{
+					while (m_running.load(std::memory_order_relaxed))
+					{
+						std::this_thread::yield();
+						if (m_ring.try_push(p_level, p_fmt, p_args...))
+						{
+							return true;
+						}
+					}
+					return false;
+				}
+				m_dropped.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+
+			auto dropped_count() const noexcept -> std::uint64_t { return m_dropped.load(std::memory_order_relaxed); }
+
+			auto stop() -> void
+			{
+				if (m_worker.joinable())
+				{
+					m_running.store(false, std::memory_order_release);
+					m_worker.join();
+					while (consume_one())
+					{
+					}
+				}
+			}
+
+		private:
+			auto run() -> void
+			{
+				while (m_running.load(std::memory_order_acquire))
+				{
+					if (!consume_one())
+					{
+						std::this_thread::sleep_for(std::chrono::microseconds(100));
+					}
+				}
+			}
+
+			auto consume_one() -> bool
+			{
+				record_data record;
+				if (!m_ring.try_pop(record))
+				{
+					return false;
+				}
+				record.m_format(*m_logger, record.m_level, spdlog::string_view_t(record.m_fmt_data, record.m_fmt_size), record.m_payload);
+				return true;
+			}
+		};
+		// On-disk framing for the binary structured log: a registration record
+		// describes a call site (format string plus argument type tags) once,
+		// then every message is just the id, a timestamp and raw argument
+		// bytes — text rendering is deferred to the decoder.
+		enum class binary_record_kind : std::uint8_t
+		{
+			registration = 0,
+			message		 = 1
+		};
+
+		enum class binary_arg_kind : std::uint8_t
+		{
+			i8,
+			i16,
+			i32,
+			i64,
+			u8,
+			u16,
+			u32,
+			u64,
+			f32,
+			f64,
+			boolean,
+			character,
+			string
+		};
+
+		template <typename type_t> struct binary_arg_traits;
+
+		template <> struct binary_arg_traits<bool>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::boolean;
+		};
+
+		template <> struct binary_arg_traits<char>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::character;
+		};
+
+		template <> struct binary_arg_traits<signed char>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::i8;
+		};
+
+		template <> struct binary_arg_traits<unsigned char>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::u8;
+		};
+
+		template <> struct binary_arg_traits<short>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::i16;
+		};
+
+		template <> struct binary_arg_traits<unsigned short>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::u16;
+		};
+
+		template <> struct binary_arg_traits<int>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::i32;
+		};
+
+		template <> struct binary_arg_traits<unsigned int>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::u32;
+		};
+
+		template <> struct binary_arg_traits<long>
+		{
+			static const binary_arg_kind kind = (sizeof(long) == 8) ? binary_arg_kind::i64 : binary_arg_kind::i32;
+		};
+
+		template <> struct binary_arg_traits<unsigned long>
+		{
+			static const binary_arg_kind kind = (sizeof(unsigned long) == 8) ? binary_arg_kind::u64 : binary_arg_kind::u32;
+		};
+
+		template <> struct binary_arg_traits<long long>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::i64;
+		};
+
+		template <> struct binary_arg_traits<unsigned long long>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::u64;
+		};
+
+		template <> struct binary_arg_traits<float>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::f32;
+		};
+
+		template <> struct binary_arg_traits<double>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::f64;
+		};
+
+		template <> struct binary_arg_traits<const char*>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::string;
+		};
+
+		template <> struct binary_arg_traits<char*>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::string;
+		};
+
+		template <> struct binary_arg_traits<std::string>
+		{
+			static const binary_arg_kind kind = binary_arg_kind::string;
+		};
+
+		inline auto binary_append(std::vector<unsigned char>& p_buf, const void* p_data, std::size_t p_size) -> void
+		{
+			if (p_size == 0)
+			{
+				return;
+			}
+			const unsigned char* bytes = static_cast<const unsigned char*>(p_data);
+			p_buf.insert(p_buf.end(), bytes, bytes + p_size);
+		}
+
+		template <typename type_t>
+		auto binary_encode_arg(std::vector<unsigned char>& p_buf, const type_t& p_value) ->
+			typename std::enable_if<std::is_arithmetic<type_t>::value>::type
+		{
+			binary_append(p_buf, &p_value, sizeof(type_t));
+		}
+
+		inline auto binary_encode_arg(std::vector<unsigned char>& p_buf, const char* p_value) -> void
+		{
+			const std::size_t raw_len = (p_value != nullptr) ? std::strlen(p_value) : 0;
+			const std::uint16_t len	  = static_cast<std::uint16_t>((raw_len > 0xFFFFU) ? 0xFFFFU : raw_len);
+			binary_append(p_buf, &len, sizeof(len));
+			binary_append(p_buf, p_value, len);
+		}
+
+		inline auto binary_encode_arg(std::vector<unsigned char>& p_buf, const std::string& p_value) -> void
+		{
+			const std::uint16_t len = static_cast<std::uint16_t>((p_value.size() > 0xFFFFU) ? 0xFFFFU : p_value.size());
+			binary_append(p_buf, &len, sizeof(len));
+			binary_append(p_buf, p_value.data(), len);
+		}
+
+		inline auto binary_encode_args(std::vector<unsigned char>&) -> void {}
+
+		template <typename head_t, typename... tail_t>
+		auto binary_encode_args(std::vector<unsigned char>& p_buf, const head_t& p_head, const tail_t&... p_tail) -> void
+		{
+			binary_encode_arg(p_buf, p_head);
+			binary_encode_args(p_buf, p_tail...);
+		}
+
+		inline auto binary_collect_tags(std::vector<std::uint8_t>&) -> void {}
+
+		template <typename head_t, typename... tail_t>
+		auto binary_collect_tags(std::vector<std::uint8_t>& p_tags, const head_t&, const tail_t&... p_tail) -> void
+		{
+			p_tags.push_back(static_cast<std::uint8_t>(binary_arg_traits<typename std::decay<head_t>::type>::kind));
+			binary_collect_tags(p_tags, p_tail...);
+		}
+
+		enum class binary_decode_error : std::uint8_t
+		{
+			end_of_log,
+			truncated_record,
+			unknown_record,
+			unregistered_id,
+			format_failed
+		};
+
+		// One static per argument pack; its address distinguishes call sites
+		// that share a merged format string literal but pass different types.
+		template <typename... args_t> struct site_anchor
+		{
+			static const unsigned char value;
+		};
+
+		template <typename... args_t> const unsigned char site_anchor<args_t...>::value = 0;
+	}	 // namespace logger_detail
+
 	class logger
 	{
 	public:
 		using self_t								  = logger;
+		using async_full_policy						  = logger_detail::async_full_policy;
 		template <typename... args_t> using fmt_str_t = spdlog::format_string_t<args_t...>;
 
 	private:
 		std::shared_ptr<spdlog::sinks::stdout_color_sink_mt> m_console_sink;
 		std::shared_ptr<spdlog::sinks::basic_file_sink_mt> m_file_sink;
 		std::shared_ptr<spdlog::logger> m_logger;
+		std::unique_ptr<logger_detail::async_engine> m_async_engine;
 		mutable bool m_enabled = true;
 
 	public:
@@ -93,13 +558,31 @@ namespace utils
 
 		auto set_level(spdlog::level::level_enum p_level) noexcept -> void { m_logger->set_level(p_level); }
 
+		// Route logging through a background thread: callers enqueue the format
+		// string pointer plus raw argument bytes into a bounded lock-free ring,
+		// formatting and sink I/O happen on a dedicated consumer thread. Only
+		// packs of trivially-copyable arguments qualify — anything else
+		// (std::string, user types) keeps the synchronous path. Format strings
+		// and char* arguments must outlive consumption, i.e. be literals.
+		auto enable_async(std::size_t p_capacity = 8192, async_full_policy p_policy = async_full_policy::drop) -> void
+		{
+			m_async_engine.reset(new logger_detail::async_engine(m_logger, p_capacity, p_policy));
+		}
+
+		// Stops the consumer thread, draining queued records first
+		auto disable_async() -> void { m_async_engine.reset(); }
+
+		auto is_async() const noexcept -> bool { return m_async_engine != nullptr; }
+
+		auto get_dropped_count() const noexcept -> std::uint64_t { return (m_async_engine != nullptr) ? m_async_engine->dropped_count() : 0; }
+
 		template <typename... args_t> auto trace(fmt_str_t<args_t...> p_fmt, args_t&&... p_args) const noexcept -> void
 		{
 			if (!m_enabled)
 			{
 				return;
 			}
-			m_logger->trace(p_fmt, std::forward<args_t>(p_args)...);
+			dispatch(spdlog::level::trace, p_fmt, std::forward<args_t>(p_args)...);
 		}
 
 		template <typename... args_t> auto debug(fmt_str_t<args_t...> p_fmt, args_t&&... p_args) const noexcept -> void
@@ -108,7 +591,7 @@ namespace utils
 			{
 				return;
 			}
-			m_logger->debug(p_fmt, std::forward<args_t>(p_args)...);
+			dispatch(spdlog::level::debug, p_fmt, std::forward<args_t>(p_args)...);
 		}
 
 		template <typename... args_t> auto info(fmt_str_t<args_t...> p_fmt, args_t&&... p_args) const noexcept -> void
@@ -117,7 +600,7 @@ namespace utils
 			{
 				return;
 			}
-			m_logger->info(p_fmt, std::forward<args_t>(p_args)...);
+			dispatch(spdlog::level::info, p_fmt, std::forward<args_t>(p_args)...);
 		}
 
 		template <typename... args_t> auto warn(fmt_str_t<args_t...> p_fmt, args_t&&... p_args) const noexcept -> void
@@ -126,7 +609,7 @@ namespace utils
 			{
 				return;
 			}
-			m_logger->warn(p_fmt, std::forward<args_t>(p_args)...);
+			dispatch(spdlog::level::warn, p_fmt, std::forward<args_t>(p_args)...);
 		}
 
 		template <typename... args_t> auto error(fmt_str_t<args_t...> p_fmt, args_t&&... p_args) const noexcept -> void
@@ -135,7 +618,7 @@ namespace utils
 			{
 				return;
 			}
-			m_logger->error(p_fmt, std::forward<args_t>(p_args)...);
+			dispatch(spdlog::level::err, p_fmt, std::forward<args_t>(p_args)...);
 		}
 
 		template <typename... args_t> auto critical(fmt_str_t<args_t...> p_fmt, args_t&&... p_args) const noexcept -> void
@@ -144,12 +627,35 @@ namespace utils
 			{
 				return;
 			}
-			m_logger->critical(p_fmt, std::forward<args_t>(p_args)...);
+			dispatch(spdlog::level::critical, p_fmt, std::forward<args_t>(p_args)...);
 		}
 
 		static auto set_global_level(spdlog::level::level_enum p_level) -> void { spdlog::set_level(p_level); }
 
 	private:
+		template <typename... args_t> auto dispatch(spdlog::level::level_enum p_level, fmt_str_t<args_t...>& p_fmt, args_t&&... p_args) const -> void
+		{
+			using eligible_t = std::integral_constant<bool, logger_detail::async_eligible<typename std::decay<args_t>::type...>::value
+															   && (logger_detail::payload_size<typename std::decay<args_t>::type...>::value
+																   <= logger_detail::k_record_payload)>;
+			if (m_async_engine != nullptr && async_log<typename std::decay<args_t>::type...>(p_level, spdlog::string_view_t(p_fmt), eligible_t{}, p_args...))
+			{
+				return;
+			}
+			m_logger->log(p_level, p_fmt, std::forward<args_t>(p_args)...);
+		}
+
+		template <typename... args_t>
+		auto async_log(spdlog::level::level_enum p_level, spdlog::string_view_t p_fmt, std::true_type, const args_t&... p_args) const -> bool
+		{
+			return m_async_engine->push<args_t...>(p_level, p_fmt, p_args...);
+		}
+
+		template <typename... args_t> auto async_log(spdlog::level::level_enum, spdlog::string_view_t, std::false_type, const args_t&...) const -> bool
+		{
+			return false;
+		}
+
 		static auto to_lower(std::string_view p_str) -> std::string
 		{
 			std::string result(p_str);
@@ -188,6 +694,341 @@ namespace utils
 		}
 	};
 
+	// Deferred-formatting log sink: each call site registers its format string
+	// once and every message after that is just a record id, a wall-clock
+	// timestamp and raw argument bytes, streamed through the write-behind
+	// utils::file mode. binary_log_decoder turns the stream back into text.
+	class binary_log
+	{
+	public:
+		using self_t  = binary_log;
+		using error_t = file_error;
+
+		static const std::uint32_t k_magic	 = 0x676C6275U;	   // "ublg"
+		static const std::uint16_t k_version = 1;
+
+	private:
+		file m_file;
+		std::map<std::pair<const void*, const void*>, std::uint32_t> m_registry;
+		std::uint32_t m_next_id = 0;
+		std::mutex m_mutex;
+		bool m_ready = false;
+
+	public:
+		explicit binary_log(const fs::path& p_path) : m_file(p_path, file_mode::write, false)
+		{
+			if (!m_file.is_open())
+			{
+				return;
+			}
+			m_file.enable_write_behind();
+			const std::uint32_t magic	= k_magic;
+			const std::uint16_t version = k_version;
+			std::vector<unsigned char> header;
+			logger_detail::binary_append(header, &magic, sizeof(magic));
+			logger_detail::binary_append(header, &version, sizeof(version));
+			m_ready = m_file.write(header.data(), header.size()).has_value();
+		}
+
+		binary_log(const self_t&)				 = delete;
+		auto operator=(const self_t&) -> self_t& = delete;
+
+		auto is_open() const noexcept -> bool { return m_ready; }
+
+		template <typename... args_t> auto write(const char* p_fmt, const args_t&... p_args) -> expected<void, error_t>
+		{
+			if (!m_ready)
+			{
+				return unexpected<error_t>(error_t::not_open);
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			const std::uint32_t id = register_site(p_fmt, p_args...);
+
+			std::vector<unsigned char> record;
+			record.reserve(64);
+			const std::uint8_t kind = static_cast<std::uint8_t>(logger_detail::binary_record_kind::message);
+			const std::uint64_t timestamp =
+				static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+			logger_detail::binary_append(record, &kind, sizeof(kind));
+			logger_detail::binary_append(record, &id, sizeof(id));
+			logger_detail::binary_append(record, &timestamp, sizeof(timestamp));
+
+			std::vector<unsigned char> payload;
+			payload.reserve(48);
+			logger_detail::binary_encode_args(payload, p_args...);
+			const std::uint32_t payload_size = static_cast<std::uint32_t>(payload.size());
+			logger_detail::binary_append(record, &payload_size, sizeof(payload_size));
+			record.insert(record.end(), payload.begin(), payload.end());
+
+			auto result = m_file.write(record.data(), record.size());
+			if (!result.has_value())
+			{
+				return unexpected<error_t>(result.error());
+			}
+			return {};
+		}
+
+		// Drains the write-behind buffers and fsyncs
+		auto flush() -> expected<void, error_t> { return m_file.flush(); }
+
+	private:
+		template <typename... args_t> auto register_site(const char* p_fmt, const args_t&... p_args) -> std::uint32_t
+		{
+			const std::pair<const void*, const void*> key(static_cast<const void*>(p_fmt),
+														  static_cast<const void*>(&logger_detail::site_anchor<args_t...>::value));
+			auto found = m_registry.find(key);
+			if (found != m_registry.end())
+			{
+				return found->second;
+			}
+
+			std::vector<std::uint8_t> tags;
+			logger_detail::binary_collect_tags(tags, p_args...);
+
+			const std::uint32_t id = m_next_id++;
+			std::vector<unsigned char> record;
+			const std::uint8_t kind	   = static_cast<std::uint8_t>(logger_detail::binary_record_kind::registration);
+			const std::uint16_t fmt_len = static_cast<std::uint16_t>(std::strlen(p_fmt));
+			const std::uint8_t argc	   = static_cast<std::uint8_t>(tags.size());
+			logger_detail::binary_append(record, &kind, sizeof(kind));
+			logger_detail::binary_append(record, &id, sizeof(id));
+			logger_detail::binary_append(record, &fmt_len, sizeof(fmt_len));
+			logger_detail::binary_append(record, p_fmt, fmt_len);
+			logger_detail::binary_append(record, &argc, sizeof(argc));
+			if (!tags.empty())
+			{
+				logger_detail::binary_append(record, tags.data(), tags.size());
+			}
+			m_file.write(record.data(), record.size());
+			m_registry.emplace(key, id);
+			return id;
+		}
+	};
+
+	// Offline reader for binary_log streams: replays registration records into
+	// a format-string table and renders each message through fmt with a
+	// dynamic argument store.
+	class binary_log_decoder
+	{
+	public:
+		using self_t		 = binary_log_decoder;
+		using decode_error_t = logger_detail::binary_decode_error;
+
+	private:
+		struct site_info
+		{
+			std::string m_fmt;
+			std::vector<std::uint8_t> m_tags;
+		};
+
+		file m_file;
+		std::size_t m_offset = 0;
+		std::uint64_t m_last_timestamp = 0;
+		std::map<std::uint32_t, site_info> m_sites;
+		bool m_valid = false;
+
+	public:
+		explicit binary_log_decoder(const fs::path& p_path) : m_file(p_path, file_mode::read, true)
+		{
+			std::uint32_t magic	  = 0;
+			std::uint16_t version = 0;
+			if (m_file.is_open() && read_value(magic) && read_value(version))
+			{
+				m_valid = (magic == binary_log::k_magic) && (version == binary_log::k_version);
+			}
+		}
+
+		auto is_open() const noexcept -> bool { return m_valid; }
+
+		auto has_next() const noexcept -> bool { return m_valid && m_offset < m_file.size(); }
+
+		// Wall-clock nanoseconds of the record last returned by decode_next
+		auto last_timestamp_ns() const noexcept -> std::uint64_t { return m_last_timestamp; }
+
+		auto decode_next() -> expected<std::string, decode_error_t>
+		{
+			while (has_next())
+			{
+				std::uint8_t kind = 0;
+				if (!read_value(kind))
+				{
+					return unexpected<decode_error_t>(decode_error_t::truncated_record);
+				}
+				if (kind == static_cast<std::uint8_t>(logger_detail::binary_record_kind::registration))
+				{
+					if (!read_registration())
+					{
+						return unexpected<decode_error_t>(decode_error_t::truncated_record);
+					}
+					continue;
+				}
+				if (kind != static_cast<std::uint8_t>(logger_detail::binary_record_kind::message))
+				{
+					return unexpected<decode_error_t>(decode_error_t::unknown_record);
+				}
+				return decode_message();
+			}
+			return unexpected<decode_error_t>(decode_error_t::end_of_log);
+		}
+
+		auto decode_all() -> std::vector<std::string>
+		{
+			std::vector<std::string> lines;
+			while (has_next())
+			{
+				auto line = decode_next();
+				if (!line.has_value())
+				{
+					break;
+				}
+				lines.push_back(std::move(line.value()));
+			}
+			return lines;
+		}
+
+	private:
+		template <typename type_t> auto read_value(type_t& p_out) -> bool
+		{
+			const file& source = m_file;
+			if (m_offset + sizeof(type_t) > source.size())
+			{
+				return false;
+			}
+			std::memcpy(&p_out, source.data() + m_offset, sizeof(type_t));
+			m_offset += sizeof(type_t);
+			return true;
+		}
+
+		auto read_bytes(std::size_t p_size, std::string& p_out) -> bool
+		{
+			const file& source = m_file;
+			if (m_offset + p_size > source.size())
+			{
+				return false;
+			}
+			p_out.assign(reinterpret_cast<const char*>(source.data() + m_offset), p_size);
+			m_offset += p_size;
+			return true;
+		}
+
+		auto read_registration() -> bool
+		{
+			std::uint32_t id	  = 0;
+			std::uint16_t fmt_len = 0;
+			std::uint8_t argc	  = 0;
+			site_info site;
+			if (!read_value(id) || !read_value(fmt_len) || !read_bytes(fmt_len, site.m_fmt) || !read_value(argc))
+			{
+				return false;
+			}
+			site.m_tags.resize(argc);
+			const file& source = m_file;
+			if (m_offset + argc > source.size())
+			{
+				return false;
+			}
+			if (argc > 0)
+			{
+				std::memcpy(site.m_tags.data(), source.data() + m_offset, argc);
+				m_offset += argc;
+			}
+			m_sites[id] = std::move(site);
+			return true;
+		}
+
+		auto decode_message() -> expected<std::string, decode_error_t>
+		{
+			std::uint32_t id		   = 0;
+			std::uint64_t timestamp	   = 0;
+			std::uint32_t payload_size = 0;
+			if (!read_value(id) || !read_value(timestamp) || !read_value(payload_size))
+			{
+				return unexpected<decode_error_t>(decode_error_t::truncated_record);
+			}
+			auto site = m_sites.find(id);
+			if (site == m_sites.end())
+			{
+				return unexpected<decode_error_t>(decode_error_t::unregistered_id);
+			}
+
+			const std::size_t payload_end = m_offset + payload_size;
+			fmt::dynamic_format_arg_store<fmt::format_context> store;
+			for (const std::uint8_t tag : site->second.m_tags)
+			{
+				if (!decode_arg(tag, store))
+				{
+					return unexpected<decode_error_t>(decode_error_t::truncated_record);
+				}
+			}
+			m_offset		 = payload_end;
+			m_last_timestamp = timestamp;
+			try
+			{
+				return fmt::vformat(site->second.m_fmt, store);
+			}
+			catch (const fmt::format_error&)
+			{
+				return unexpected<decode_error_t>(decode_error_t::format_failed);
+			}
+		}
+
+		auto decode_arg(std::uint8_t p_tag, fmt::dynamic_format_arg_store<fmt::format_context>& p_store) -> bool
+		{
+			switch (static_cast<logger_detail::binary_arg_kind>(p_tag))
+			{
+			case logger_detail::binary_arg_kind::i8:
+				return decode_scalar<std::int8_t>(p_store);
+			case logger_detail::binary_arg_kind::i16:
+				return decode_scalar<std::int16_t>(p_store);
+			case logger_detail::binary_arg_kind::i32:
+				return decode_scalar<std::int32_t>(p_store);
+			case logger_detail::binary_arg_kind::i64:
+				return decode_scalar<std::int64_t>(p_store);
+			case logger_detail::binary_arg_kind::u8:
+				return decode_scalar<std::uint8_t>(p_store);
+			case logger_detail::binary_arg_kind::u16:
+				return decode_scalar<std::uint16_t>(p_store);
+			case logger_detail::binary_arg_kind::u32:
+				return decode_scalar<std::uint32_t>(p_store);
+			case logger_detail::binary_arg_kind::u64:
+				return decode_scalar<std::uint64_t>(p_store);
+			case logger_detail::binary_arg_kind::f32:
+				return decode_scalar<float>(p_store);
+			case logger_detail::binary_arg_kind::f64:
+				return decode_scalar<double>(p_store);
+			case logger_detail::binary_arg_kind::boolean:
+				return decode_scalar<bool>(p_store);
+			case logger_detail::binary_arg_kind::character:
+				return decode_scalar<char>(p_store);
+			case logger_detail::binary_arg_kind::string:
+			{
+				std::uint16_t len = 0;
+				std::string text;
+				if (!read_value(len) || !read_bytes(len, text))
+				{
+					return false;
+				}
+				p_store.push_back(std::move(text));
+				return true;
+			}
+			default:
+				return false;
+			}
+		}
+
+		template <typename type_t> auto decode_scalar(fmt::dynamic_format_arg_store<fmt::format_context>& p_store) -> bool
+		{
+			type_t value;
+			if (!read_value(value))
+			{
+				return false;
+			}
+			p_store.push_back(value);
+			return true;
+		}
+	};
+
 }	 // namespace utils
 
 #endif
\ No newline at end of file
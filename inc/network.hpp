@@ -3,13 +3,18 @@
 	#define NETWORK_HPP
 
 	#include <algorithm>
+	#include <cerrno>
 	#include <cstdint>
 	#include <cstring>
+	#include <memory>
+	#include <mutex>
 	#include <string>
 	#include <vector>
 
 	#include <ifaddrs.h>
 	#include <linux/if_packet.h>
+	#include <linux/netlink.h>
+	#include <linux/rtnetlink.h>
 	#include <net/if.h>
 	#include <sys/socket.h>
 	#include <unistd.h>
@@ -261,6 +266,146 @@ namespace utils
 				return interfaces[0];
 			}
 		};
+
+		// Caches get_all_network_interfaces() behind a netlink RTMGRP_LINK
+		// subscription: the interface list is enumerated once into an immutable
+		// snapshot, and queries re-enumerate only after the kernel has reported
+		// a link change. Draining the (usually empty) netlink socket is one
+		// non-blocking recv, so the steady-state query cost is that syscall plus
+		// a shared_ptr copy instead of a full getifaddrs walk. If the netlink
+		// socket cannot be opened, every query falls back to re-enumerating.
+		class interface_cache
+		{
+		public:
+			using self_t	 = interface_cache;
+			using snapshot_t = std::shared_ptr<const std::vector<interface_info> >;
+
+		private:
+			std::int32_t m_netlink_fd;
+			snapshot_t m_snapshot;
+			std::mutex m_mutex;
+
+			interface_cache() : m_netlink_fd(-1)
+			{
+				m_netlink_fd = socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+				if (m_netlink_fd >= 0)
+				{
+					struct sockaddr_nl addr;
+					std::memset(&addr, 0, sizeof(addr));
+					addr.nl_family = AF_NETLINK;
+					addr.nl_groups = RTMGRP_LINK;
+					if (bind(m_netlink_fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0)
+					{
+						close(m_netlink_fd);
+						m_netlink_fd = -1;
+					}
+				}
+			}
+
+			~interface_cache()
+			{
+				if (m_netlink_fd >= 0)
+				{
+					close(m_netlink_fd);
+				}
+			}
+
+		public:
+			interface_cache(const self_t&)			 = delete;
+			auto operator=(const self_t&) -> self_t& = delete;
+
+			static auto instance() -> self_t&
+			{
+				static self_t cache;
+				return cache;
+			}
+
+			auto get(bool p_force_refresh = false) -> snapshot_t
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (p_force_refresh || m_snapshot == nullptr || link_change_pending())
+				{
+					m_snapshot = snapshot_t(new std::vector<interface_info>(network_utils::get_all_network_interfaces()));
+				}
+				return m_snapshot;
+			}
+
+			auto invalidate() -> void
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_snapshot.reset();
+			}
+
+			auto is_subscribed() const -> bool { return m_netlink_fd >= 0; }
+
+		private:
+			// Drains pending netlink messages; true if the kernel reported a
+			// link change since the last drain. Without a subscription there is
+			// no way to know, so the cache must be treated as stale.
+			auto link_change_pending() -> bool
+			{
+				if (m_netlink_fd < 0)
+				{
+					return true;
+				}
+
+				bool changed = false;
+				for (;;)
+				{
+					char buffer[4096];
+					const ssize_t len = recv(m_netlink_fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+					if (len < 0)
+					{
+						// Kernel dropped events on overflow; assume a change
+						if (errno == ENOBUFS)
+						{
+							changed = true;
+							continue;
+						}
+						break;
+					}
+					if (len == 0)
+					{
+						break;
+					}
+
+					auto remaining = static_cast<std::uint32_t>(len);
+					for (struct nlmsghdr* hdr = reinterpret_cast<struct nlmsghdr*>(buffer); NLMSG_OK(hdr, remaining); hdr = NLMSG_NEXT(hdr, remaining))
+					{
+						if (hdr->nlmsg_type == RTM_NEWLINK || hdr->nlmsg_type == RTM_DELLINK)
+						{
+							changed = true;
+						}
+					}
+				}
+				return changed;
+			}
+		};
+
+		inline auto get_cached_interfaces() -> interface_cache::snapshot_t
+		{
+			return interface_cache::instance().get();
+		}
+
+		inline auto get_permanent_mac_address_cached() -> std::string
+		{
+			auto snapshot = interface_cache::instance().get();
+			if (snapshot->empty())
+			{
+				return "";
+			}
+			return (*snapshot)[0].mac_address;
+		}
+
+		inline auto get_best_interface_info_cached() -> interface_info
+		{
+			auto snapshot = interface_cache::instance().get();
+			if (snapshot->empty())
+			{
+				return {};
+			}
+			return (*snapshot)[0];
+		}
 	}	 // namespace network
 }	 // namespace utils
 
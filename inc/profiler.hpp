@@ -3,16 +3,23 @@
 	#define PROFILER_HPP
 
 	#include <algorithm>
+	#include <atomic>
 	#include <chrono>
+	#include <fstream>
 	#include <iomanip>
 	#include <iostream>
 	#include <map>
 	#include <memory>
+	#include <mutex>
 	#include <sstream>
 	#include <string>
+	#include <thread>
 	#include <utility>
 	#include <vector>
 
+	#include "cmemory.hpp"
+	#include "small_vector.hpp"
+
 namespace utils
 {
 
@@ -89,12 +96,57 @@ namespace utils
 			}
 		};
 
+		enum class event_kind : std::uint8_t
+		{
+			begin,
+			end
+		};
+
+		// One entry in a thread's event buffer. Names and files are expected to
+		// be string literals (stable addresses), so only pointers are stored.
+		struct profile_event
+		{
+			const char* m_name;
+			const char* m_file;
+			std::uint64_t m_timestamp_ns;
+			std::int32_t m_line;
+			event_kind m_kind;
+		};
+
+		// Preallocated per-thread buffer; only the owning thread appends. The
+		// count is atomic so a merge from another thread acquires the slot
+		// writes published by the owner's release store — events recorded
+		// while a merge is in flight may be deferred or replayed once more,
+		// but never torn. Overflowing events are counted and dropped.
+		struct event_buffer
+		{
+			static const std::size_t k_capacity = 1U << 16U;
+
+			std::vector<profile_event> m_events;
+			std::atomic<std::size_t> m_count{0};
+			std::atomic<std::uint64_t> m_dropped{0};
+			std::thread::id m_thread_id;
+
+			event_buffer() : m_events(k_capacity), m_thread_id(std::this_thread::get_id()) {}
+		};
+
 	private:
 		// ~~~ Member variables ~~~
 		std::map<std::string, frame> m_functions;								   // Map of function names to their profiling data
-		std::vector<profiler_recorder*> m_call_stack;							   // Active call stack for hierarchy tracking
-		std::vector<std::shared_ptr<hierarchical_frame> > m_hierarchical_stack;	   // Stack of active hierarchical frames
+		small_vector<profiler_recorder*, 32> m_call_stack;							   // Active call stack for hierarchy tracking
+		small_vector<std::shared_ptr<hierarchical_frame>, 32> m_hierarchical_stack;	   // Stack of active hierarchical frames
 		std::vector<std::shared_ptr<hierarchical_frame> > m_call_tree;			   // Root level calls
+		std::vector<std::unique_ptr<event_buffer> > m_event_buffers;			   // Per-thread event buffers for the lock-free path
+		std::unique_ptr<std::mutex> m_event_mutex;								   // Guards buffer registration and merge, not recording
+
+		// String interning for the event path: each unique name pointer maps to
+		// a small id once (open addressing on the pointer value), and frames
+		// live in a flat vector indexed by id — no string compares per record.
+		std::vector<const char*> m_intern_keys;									   // Probe table, NULL = empty slot
+		std::vector<std::uint32_t> m_intern_ids;								   // Id for the key in the same slot
+		std::size_t m_intern_used = 0;
+		std::vector<const char*> m_id_names;									   // Id -> name
+		std::vector<frame> m_id_frames;											   // Id -> aggregate frame
 
 	public:
 		// ~~~ Public functions ~~~
@@ -112,18 +164,43 @@ namespace utils
 		auto push_recorder(profiler_recorder& p_recorder) -> void;
 		auto pop_recorder(profiler_recorder& p_recorder) -> void;
 
-		auto print_summary() const -> void;
-		auto print_tree() const -> void;
+		auto print_summary() -> void;
+		auto print_tree() -> void;
 		auto clear() -> void;
 
 		auto record_timing(const std::string& p_name, std::uint32_t p_elapsed_time) -> void;
 		auto record_hierarchical_timing(const profiler_recorder& p_recorder, std::uint32_t p_elapsed_time) -> void;
 
+		// Hot path of the lock-free mode: one slot write into the calling
+		// thread's buffer, no locks or allocation (profiler_scope uses this).
+		auto emit_event(event_kind p_kind, const char* p_name, const char* p_file, std::int32_t p_line) -> void;
+
+		// Replays all thread buffers into the aggregate map and call tree,
+		// then resets them. Called by print_summary()/print_tree(); scopes
+		// still open at merge time are discarded.
+		auto collect_events() -> void;
+
+		// Writes the recorded events as Chrome trace_event JSON (loadable in
+		// chrome://tracing and the Perfetto UI). Reads the buffers without
+		// resetting them, so call before print_summary()/print_tree(), which
+		// consume the events.
+		auto export_chrome_trace(const std::string& p_path) const -> bool;
+
 		~profiler() = default;
-		profiler()	= default;
+		profiler() : m_event_mutex(new std::mutex()) {}
 
 	private:
 		// ~~~ Private functions ~~~
+		auto acquire_event_buffer() -> event_buffer*;
+		auto replay_event_buffer(event_buffer& p_buffer) -> void;
+		auto intern_name(const char* p_name) -> std::uint32_t;
+		auto grow_intern_table(std::size_t p_capacity) -> void;
+		auto record_timing_by_id(std::uint32_t p_id, std::uint32_t p_elapsed_time) -> void;
+		auto merged_functions() const -> std::map<std::string, frame>;
+		static auto now_ns() -> std::uint64_t
+		{
+			return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
 		static auto format_time(std::uint32_t p_time_ns) -> std::string;
 		static auto format_frame(const std::string& p_name, const frame& p_frame) -> std::string;
 		static auto print_hierarchical_frame(const std::shared_ptr<hierarchical_frame>& p_frame, std::uint32_t p_indent = 0) -> void;
@@ -133,6 +210,33 @@ namespace utils
 		// ~~~ Setters and Getters ~~~
 	};
 
+	// Low-overhead alternative to profiler_recorder: records begin/end events
+	// into the calling thread's buffer with no map lookup, no string copy and
+	// no allocation. Use with string literals only.
+	class profiler_scope
+	{
+	public:
+		using self_t = profiler_scope;
+
+	private:
+		profiler& m_profiler;
+		const char* m_name;
+
+	public:
+		~profiler_scope() { m_profiler.emit_event(profiler::event_kind::end, m_name, "", 0); }
+
+		explicit profiler_scope(const char* p_name, const char* p_file = "", std::int32_t p_line = 0, profiler& p_profiler = profiler::get_instance())
+			: m_profiler(p_profiler), m_name(p_name)
+		{
+			m_profiler.emit_event(profiler::event_kind::begin, p_name, p_file, p_line);
+		}
+
+		profiler_scope(const self_t&)			 = delete;
+		profiler_scope(self_t&&)				 = delete;
+		auto operator=(const self_t&) -> self_t& = delete;
+		auto operator=(self_t&&) -> self_t&		 = delete;
+	};
+
 	// ~~~ Method implementations ~~~
 
 	inline profiler_recorder::~profiler_recorder()
@@ -153,7 +257,8 @@ namespace utils
 
 		// Create hierarchical frame and add to appropriate location
 		std::uint32_t depth = m_hierarchical_stack.size();
-		auto new_frame		= std::make_shared<hierarchical_frame>(p_recorder.m_name, p_recorder.m_file_name, p_recorder.m_line, depth);
+		auto new_frame		= std::allocate_shared<hierarchical_frame>(cmemory::pool_allocator<hierarchical_frame>(), p_recorder.m_name, p_recorder.m_file_name,
+																	   p_recorder.m_line, depth);
 
 		if (depth == 0)
 		{
@@ -211,6 +316,279 @@ namespace utils
 		}
 	}
 
+	inline auto profiler::emit_event(event_kind p_kind, const char* p_name, const char* p_file, std::int32_t p_line) -> void
+	{
+		struct event_cache
+		{
+			profiler* owner		 = NULL;
+			event_buffer* buffer = NULL;
+		};
+		static thread_local event_cache t_cache;
+
+		if (t_cache.owner != this)
+		{
+			t_cache.buffer = acquire_event_buffer();
+			t_cache.owner  = this;
+		}
+
+		// Acquire pairs with the merge's release reset: once the owner observes
+		// the count at 0, the merge's reads of the recycled slots are ordered
+		// before the writes below
+		event_buffer& buffer	= *t_cache.buffer;
+		const std::size_t count = buffer.m_count.load(std::memory_order_acquire);
+		if (count < buffer.m_events.size())
+		{
+			profile_event& event = buffer.m_events[count];
+			event.m_name		 = p_name;
+			event.m_file		 = p_file;
+			event.m_line		 = p_line;
+			event.m_kind		 = p_kind;
+			event.m_timestamp_ns = now_ns();
+
+			// Publish the slot writes above to a merging thread
+			buffer.m_count.store(count + 1, std::memory_order_release);
+		}
+		else
+		{
+			buffer.m_dropped.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	inline auto profiler::acquire_event_buffer() -> event_buffer*
+	{
+		const std::lock_guard<std::mutex> lock(*m_event_mutex);
+		const std::thread::id this_id = std::this_thread::get_id();
+		for (const auto& buffer : m_event_buffers)
+		{
+			if (buffer->m_thread_id == this_id)
+			{
+				return buffer.get();
+			}
+		}
+		m_event_buffers.emplace_back(new event_buffer());
+		return m_event_buffers.back().get();
+	}
+
+	inline auto profiler::collect_events() -> void
+	{
+		const std::lock_guard<std::mutex> lock(*m_event_mutex);
+		for (const auto& buffer : m_event_buffers)
+		{
+			replay_event_buffer(*buffer);
+			buffer->m_count.store(0, std::memory_order_release);
+		}
+	}
+
+	inline auto profiler::replay_event_buffer(event_buffer& p_buffer) -> void
+	{
+		struct open_scope
+		{
+			const profile_event* begin;
+			std::shared_ptr<hierarchical_frame> frame;
+		};
+		std::vector<open_scope> stack;
+
+		const std::size_t count = p_buffer.m_count.load(std::memory_order_acquire);
+		for (std::size_t idx_for = 0; idx_for < count; ++idx_for)
+		{
+			const profile_event& event = p_buffer.m_events[idx_for];
+			if (event.m_kind == event_kind::begin)
+			{
+				auto new_frame = std::allocate_shared<hierarchical_frame>(cmemory::pool_allocator<hierarchical_frame>(), event.m_name,
+																		  (event.m_file != NULL) ? event.m_file : "", event.m_line,
+																		  static_cast<std::uint32_t>(stack.size()));
+				if (stack.empty())
+				{
+					m_call_tree.push_back(new_frame);
+				}
+				else
+				{
+					new_frame->m_parent = stack.back().frame.get();
+					stack.back().frame->m_children.push_back(new_frame);
+				}
+				stack.push_back(open_scope{&event, new_frame});
+			}
+			else if (!stack.empty())
+			{
+				const open_scope open = stack.back();
+				stack.pop_back();
+				const std::uint32_t elapsed = static_cast<std::uint32_t>(event.m_timestamp_ns - open.begin->m_timestamp_ns);
+				open.frame->m_elapsed_time	= elapsed;
+				record_timing_by_id(intern_name(open.begin->m_name), elapsed);
+			}
+		}
+	}
+
+	inline auto profiler::intern_name(const char* p_name) -> std::uint32_t
+	{
+		if (m_intern_keys.empty())
+		{
+			grow_intern_table(64);
+		}
+
+		std::size_t mask = m_intern_keys.size() - 1;
+		std::size_t slot = (reinterpret_cast<std::uintptr_t>(p_name) >> 4) & mask;
+		while (m_intern_keys[slot] != NULL)
+		{
+			if (m_intern_keys[slot] == p_name)
+			{
+				return m_intern_ids[slot];
+			}
+			slot = (slot + 1) & mask;
+		}
+
+		if ((m_intern_used + 1) * 4 > m_intern_keys.size() * 3)
+		{
+			grow_intern_table(m_intern_keys.size() * 2);
+			mask = m_intern_keys.size() - 1;
+			slot = (reinterpret_cast<std::uintptr_t>(p_name) >> 4) & mask;
+			while (m_intern_keys[slot] != NULL)
+			{
+				slot = (slot + 1) & mask;
+			}
+		}
+
+		const std::uint32_t new_id = static_cast<std::uint32_t>(m_id_names.size());
+		m_id_names.push_back(p_name);
+		m_id_frames.push_back(frame());
+		m_intern_keys[slot] = p_name;
+		m_intern_ids[slot]	= new_id;
+		m_intern_used++;
+		return new_id;
+	}
+
+	inline auto profiler::grow_intern_table(std::size_t p_capacity) -> void
+	{
+		const std::vector<const char*> old_keys	   = m_intern_keys;
+		const std::vector<std::uint32_t> old_ids   = m_intern_ids;
+
+		m_intern_keys.assign(p_capacity, NULL);
+		m_intern_ids.assign(p_capacity, 0);
+
+		const std::size_t mask = p_capacity - 1;
+		for (std::size_t idx_for = 0; idx_for < old_keys.size(); ++idx_for)
+		{
+			if (old_keys[idx_for] == NULL)
+			{
+				continue;
+			}
+			std::size_t slot = (reinterpret_cast<std::uintptr_t>(old_keys[idx_for]) >> 4) & mask;
+			while (m_intern_keys[slot] != NULL)
+			{
+				slot = (slot + 1) & mask;
+			}
+			m_intern_keys[slot] = old_keys[idx_for];
+			m_intern_ids[slot]	= old_ids[idx_for];
+		}
+	}
+
+	inline auto profiler::record_timing_by_id(std::uint32_t p_id, std::uint32_t p_elapsed_time) -> void
+	{
+		frame& f = m_id_frames[p_id];
+
+		if (f.m_count == 0)
+		{
+			f.m_min_time = p_elapsed_time;
+			f.m_max_time = p_elapsed_time;
+		}
+		else
+		{
+			f.m_min_time = std::min(p_elapsed_time, f.m_min_time);
+			f.m_max_time = std::max(p_elapsed_time, f.m_max_time);
+		}
+
+		f.m_count++;
+		f.m_total_time += p_elapsed_time;
+	}
+
+	// Folds the id-keyed frames into a copy of the string-keyed map so the
+	// summary shows both recording paths under one name, deduplicating names
+	// that were interned from several literal addresses.
+	inline auto profiler::merged_functions() const -> std::map<std::string, frame>
+	{
+		std::map<std::string, frame> merged = m_functions;
+		for (std::size_t idx_for = 0; idx_for < m_id_frames.size(); ++idx_for)
+		{
+			const frame& source = m_id_frames[idx_for];
+			if (source.m_count == 0)
+			{
+				continue;
+			}
+
+			frame& target = merged[m_id_names[idx_for]];
+			if (target.m_count == 0)
+			{
+				target = source;
+			}
+			else
+			{
+				target.m_min_time = std::min(target.m_min_time, source.m_min_time);
+				target.m_max_time = std::max(target.m_max_time, source.m_max_time);
+				target.m_count += source.m_count;
+				target.m_total_time += source.m_total_time;
+			}
+		}
+		return merged;
+	}
+
+	inline auto profiler::export_chrome_trace(const std::string& p_path) const -> bool
+	{
+		std::ofstream output(p_path, std::ios::out | std::ios::trunc);
+		if (!output.is_open())
+		{
+			return false;
+		}
+
+		// Minimal JSON string escaping; names are code identifiers and paths
+		auto escape = [](const char* p_text) -> std::string
+		{
+			std::string escaped;
+			for (const char* iter = p_text; *iter != '\0'; iter = std::next(iter))
+			{
+				if (*iter == '"' || *iter == '\\')
+				{
+					escaped.push_back('\\');
+				}
+				escaped.push_back(*iter);
+			}
+			return escaped;
+		};
+
+		const std::lock_guard<std::mutex> lock(*m_event_mutex);
+
+		output << "{\"traceEvents\":[";
+		bool first = true;
+		for (std::size_t tid = 0; tid < m_event_buffers.size(); ++tid)
+		{
+			const event_buffer& buffer = *m_event_buffers[tid];
+			const std::size_t count	   = buffer.m_count.load(std::memory_order_acquire);
+			for (std::size_t idx_for = 0; idx_for < count; ++idx_for)
+			{
+				const profile_event& event = buffer.m_events[idx_for];
+				if (!first)
+				{
+					output << ",";
+				}
+				first = false;
+
+				// Chrome expects microsecond timestamps; keep ns resolution
+				// via a fractional part
+				const std::uint64_t whole_us   = event.m_timestamp_ns / 1000;
+				const std::uint64_t remnant_ns = event.m_timestamp_ns % 1000;
+				output << "{\"name\":\"" << escape(event.m_name) << "\",\"cat\":\"function\",\"ph\":\"" << ((event.m_kind == event_kind::begin) ? 'B' : 'E')
+					   << "\",\"ts\":" << whole_us << "." << std::setfill('0') << std::setw(3) << remnant_ns << std::setfill(' ') << ",\"pid\":1,\"tid\":"
+					   << (tid + 1);
+				if (event.m_kind == event_kind::begin && event.m_file != NULL && event.m_file[0] != '\0')
+				{
+					output << ",\"args\":{\"file\":\"" << escape(event.m_file) << "\",\"line\":" << event.m_line << "}";
+				}
+				output << "}";
+			}
+		}
+		output << "]}";
+		return output.good();
+	}
+
 	inline auto profiler::format_frame(const std::string& p_name, const frame& p_frame) -> std::string
 	{
 		std::stringstream ss;
@@ -230,22 +608,27 @@ namespace utils
 		return ss.str();
 	}
 
-	inline auto profiler::print_summary() const -> void
+	inline auto profiler::print_summary() -> void
 	{
+		collect_events();
+
 		std::cout << "\n=== Profiler Summary ===\n";
 		std::cout << std::left << std::setw(83) << "Function Name" << std::right << std::setw(8) << "Calls" << std::setw(14) << "Total" << std::setw(14) << "Avg" << std::setw(14) << "Min"
 				  << std::setw(14) << "Max" << "\n";
 		std::cout << std::string(147, '-') << "\n";
 
-		for (const auto& m_function : m_functions)
+		const std::map<std::string, frame> merged = merged_functions();
+		for (const auto& m_function : merged)
 		{
 			std::cout << format_frame(m_function.first, m_function.second) << "\n";
 		}
 		std::cout << "\n";
 	}
 
-	inline auto profiler::print_tree() const -> void
+	inline auto profiler::print_tree() -> void
 	{
+		collect_events();
+
 		std::cout << "\n=== Profiler Call Tree ===\n";
 		for (const auto& root_frame : m_call_tree)
 		{
@@ -266,6 +649,19 @@ namespace utils
 		m_call_stack.clear();
 		m_hierarchical_stack.clear();
 		m_call_tree.clear();
+
+		m_intern_keys.clear();
+		m_intern_ids.clear();
+		m_intern_used = 0;
+		m_id_names.clear();
+		m_id_frames.clear();
+
+		const std::lock_guard<std::mutex> lock(*m_event_mutex);
+		for (const auto& buffer : m_event_buffers)
+		{
+			buffer->m_count.store(0, std::memory_order_release);
+			buffer->m_dropped.store(0, std::memory_order_relaxed);
+		}
 	}
 
 	inline auto profiler::print_hierarchical_frame(const std::shared_ptr<hierarchical_frame>& p_frame, std::uint32_t p_indent) -> void
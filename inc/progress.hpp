@@ -3,10 +3,13 @@
 	#define PROGRESS_HPP
 
 	#include <atomic>
+	#include <chrono>
+	#include <cstdint>
 	#include <cstdio>
 	#include <mutex>
 	#include <stdexcept>
 	#include <string>
+	#include <thread>
 
 	#include "format.hpp"
 
@@ -27,12 +30,15 @@ public:
 		  m_is_incremental(p_other.m_is_incremental.load()),
 		  m_is_verbose(p_other.m_is_verbose.load())
 	{
+		p_other.stop_renderer();
 	}
 
 	auto operator=(self_t&& p_other) noexcept -> self_t&
 	{
 		if (this != &p_other)
 		{
+			stop_renderer();
+			p_other.stop_renderer();
 			m_progress.store(p_other.m_progress.load());
 			m_total.store(p_other.m_total.load());
 			m_fill_char.store(p_other.m_fill_char.load());
@@ -42,7 +48,105 @@ public:
 		return *this;
 	}
 
-	~progress() = default;
+	~progress() { stop_renderer(); }
+
+	// Per-thread accumulator for hot loops: increments land in a plain local
+	// counter and are flushed to the shared atomic only every N items or M
+	// milliseconds, so workers stop bouncing the progress cacheline between
+	// cores. The destructor flushes whatever is still pending.
+	class batch_handle
+	{
+	public:
+		using self_t = batch_handle;
+
+		explicit batch_handle(progress& p_target, std::size_t p_flush_every = 256, std::uint32_t p_flush_interval_ms = 50)
+			: m_target(&p_target),
+			  m_flush_every(p_flush_every > 0 ? p_flush_every : 1),
+			  m_flush_interval(std::chrono::milliseconds(p_flush_interval_ms)),
+			  m_pending(0),
+			  m_ticks(0),
+			  m_last_flush(std::chrono::steady_clock::now())
+		{
+		}
+
+		batch_handle(const self_t&)				 = delete;
+		auto operator=(const self_t&) -> self_t& = delete;
+
+		batch_handle(self_t&& p_other) noexcept
+			: m_target(p_other.m_target),
+			  m_flush_every(p_other.m_flush_every),
+			  m_flush_interval(p_other.m_flush_interval),
+			  m_pending(p_other.m_pending),
+			  m_ticks(p_other.m_ticks),
+			  m_last_flush(p_other.m_last_flush)
+		{
+			p_other.m_target  = nullptr;
+			p_other.m_pending = 0;
+		}
+
+		auto operator=(self_t&& p_other) noexcept -> self_t&
+		{
+			if (this != &p_other)
+			{
+				flush();
+				m_target		  = p_other.m_target;
+				m_flush_every	  = p_other.m_flush_every;
+				m_flush_interval  = p_other.m_flush_interval;
+				m_pending		  = p_other.m_pending;
+				m_ticks			  = p_other.m_ticks;
+				m_last_flush	  = p_other.m_last_flush;
+				p_other.m_target  = nullptr;
+				p_other.m_pending = 0;
+			}
+			return *this;
+		}
+
+		~batch_handle() { flush(); }
+
+		auto tick(std::size_t p_amount = 1) -> void
+		{
+			m_pending += p_amount;
+			if (m_pending >= m_flush_every)
+			{
+				flush();
+				return;
+			}
+
+			// The clock is only consulted every few ticks so the common path
+			// stays a pair of local increments
+			if ((++m_ticks & k_time_check_mask) == 0 && (std::chrono::steady_clock::now() - m_last_flush) >= m_flush_interval)
+			{
+				flush();
+			}
+		}
+
+		auto flush() -> void
+		{
+			if (m_target != nullptr && m_pending > 0)
+			{
+				m_target->m_progress.fetch_add(m_pending);
+				m_pending = 0;
+			}
+			m_last_flush = std::chrono::steady_clock::now();
+		}
+
+		auto pending() const -> std::size_t { return m_pending; }
+
+	private:
+		static constexpr std::uint32_t k_time_check_mask = 0x3F;
+
+		progress* m_target;
+		std::size_t m_flush_every;
+		std::chrono::steady_clock::duration m_flush_interval;
+		std::size_t m_pending;
+		std::uint32_t m_ticks;
+		std::chrono::steady_clock::time_point m_last_flush;
+	};
+
+	auto make_batch(std::size_t p_flush_every = 256, std::uint32_t p_flush_interval_ms = 50) -> batch_handle
+	{
+		return batch_handle(*this, p_flush_every, p_flush_interval_ms);
+	}
 
 	auto set_progress(std::size_t p_progress) -> void { m_progress.store(p_progress); }
 
@@ -76,6 +180,56 @@ public:
 			return;
 		}
 
+		render();
+	}
+
+	// Starts a background thread repainting the bar at a fixed cadence, so
+	// workers never render from their own loops; the thread exits on
+	// stop_renderer (drawing a final frame) or automatically once done()
+	auto start_renderer(std::uint32_t p_interval_ms = 100) -> void
+	{
+		if (m_render_thread.joinable())
+		{
+			return;
+		}
+
+		m_render_stop.store(false);
+		m_render_thread = std::thread(
+			[this, p_interval_ms]() -> void
+			{
+				while (!m_render_stop.load())
+				{
+					render();
+					if (done())
+					{
+						break;
+					}
+					std::this_thread::sleep_for(std::chrono::milliseconds(p_interval_ms));
+				}
+				render();
+			});
+	}
+
+	auto stop_renderer() -> void
+	{
+		if (m_render_thread.joinable())
+		{
+			m_render_stop.store(true);
+			m_render_thread.join();
+		}
+	}
+
+	auto is_renderer_running() const -> bool { return m_render_thread.joinable(); }
+
+	auto reset() -> void { m_progress.store(0); }
+
+	auto done() const -> bool { return m_progress.load() >= m_total.load(); }
+
+	auto increment(std::size_t p_amount = 1) -> void { m_progress.fetch_add(p_amount); }
+
+private:
+	auto render() -> void
+	{
 		const auto current_progress = m_progress.load();
 		const auto current_total	= m_total.load();
 		const auto current_fill		= m_fill_char.load();
@@ -101,18 +255,13 @@ public:
 		}
 	}
 
-	auto reset() -> void { m_progress.store(0); }
-
-	auto done() const -> bool { return m_progress.load() >= m_total.load(); }
-
-	auto increment(std::size_t p_amount = 1) -> void { m_progress.fetch_add(p_amount); }
-
-private:
 	std::atomic<std::size_t> m_progress{0};
 	std::atomic<std::size_t> m_total{0};
 	std::atomic<char> m_fill_char{'#'};
 	std::atomic<bool> m_is_incremental{false};
 	std::atomic<bool> m_is_verbose{false};
+	std::atomic<bool> m_render_stop{false};
+	std::thread m_render_thread;
 
 	std::mutex m_print_mutex;
 };
@@ -1,12 +1,26 @@
 #ifndef RANGES_HPP
 #define RANGES_HPP
 #include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <mutex>
+#include <queue>
 #include <random>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+	#include <immintrin.h>
+#endif
+
+#include "task_scheduler.hpp"
 
 namespace ranges
 {
@@ -325,6 +339,30 @@ namespace ranges
 		return ref_view<const range_t>(p_r);
 	}
 
+	template <typename range_t> class owning_view;
+
+	namespace detail
+	{
+		// Rvalue ranges handed to an adaptor must not be captured by reference.
+		// Views are cheap to move, everything else is taken over by an owning_view.
+		template <typename range_t> inline auto all_rvalue(range_t&& p_range, std::true_type) -> remove_cvref_t<range_t>
+		{
+			return std::move(p_range);
+		}
+
+		template <typename range_t> inline auto all_rvalue(range_t&& p_range, std::false_type) -> owning_view<remove_cvref_t<range_t>>
+		{
+			return owning_view<remove_cvref_t<range_t>>(std::move(p_range));
+		}
+	}	 // namespace detail
+
+	template <typename range_t, typename = typename std::enable_if<!std::is_lvalue_reference<range_t>::value>::type>
+	inline auto all(range_t&& p_r)
+		-> decltype(detail::all_rvalue(std::move(p_r), std::integral_constant<bool, is_view<remove_cvref_t<range_t>>::value>()))
+	{
+		return detail::all_rvalue(std::move(p_r), std::integral_constant<bool, is_view<remove_cvref_t<range_t>>::value>());
+	}
+
 	template <typename value_t> class dynamic_array
 	{
 		value_t* m_data;
@@ -444,6 +482,8 @@ namespace ranges
 		inline auto empty() const -> bool { return m_size == 0; }
 	};
 
+	template <typename random_iter> inline auto sort(random_iter p_first, random_iter p_last) -> void;
+
 	template <typename container_t> class sorted_view
 	{
 		container_t m_container;
@@ -458,7 +498,7 @@ namespace ranges
 
 		template <typename range_t> explicit sorted_view(range_t&& p_range) : m_container(std::begin(p_range), std::end(p_range))
 		{
-			std::sort(m_container.begin(), m_container.end());
+			ranges::sort(m_container.begin(), m_container.end());
 		}
 
 		sorted_view(sorted_view&& p_other)			  = default;
@@ -1631,9 +1671,10 @@ namespace ranges
 		{
 			struct partial
 			{
-				template <typename range_t> inline auto operator()(range_t&& p_range) const -> common_view<ref_view<remove_cvref_t<range_t>>>
+				template <typename range_t>
+				inline auto operator()(range_t&& p_range) const -> common_view<decltype(all(std::forward<range_t>(p_range)))>
 				{
-					return common_view<ref_view<remove_cvref_t<range_t>>>(all(p_range));
+					return common_view<decltype(all(std::forward<range_t>(p_range)))>(all(std::forward<range_t>(p_range)));
 				}
 			};
 
@@ -1644,9 +1685,10 @@ namespace ranges
 		{
 			struct partial
 			{
-				template <typename range_t> inline auto operator()(range_t&& p_range) const -> reverse_view<ref_view<remove_cvref_t<range_t>>>
+				template <typename range_t>
+				inline auto operator()(range_t&& p_range) const -> reverse_view<decltype(all(std::forward<range_t>(p_range)))>
 				{
-					return reverse_view<ref_view<remove_cvref_t<range_t>>>(all(p_range));
+					return reverse_view<decltype(all(std::forward<range_t>(p_range)))>(all(std::forward<range_t>(p_range)));
 				}
 			};
 
@@ -1695,6 +1737,74 @@ namespace ranges
 		{
 			return ref_view<range_t>(p_range);
 		}
+
+		// Two adaptor closures fused into one; applying the pipeline threads the range
+		// through both stages in a single lazy traversal.
+		template <typename first_t, typename second_t> struct pipeline
+		{
+			first_t m_first;
+			second_t m_second;
+
+			inline pipeline(first_t p_first, second_t p_second) : m_first(std::move(p_first)), m_second(std::move(p_second)) {}
+
+			template <typename range_t>
+			inline auto operator()(range_t&& p_range) const -> decltype(m_second(m_first(std::forward<range_t>(p_range))))
+			{
+				return m_second(m_first(std::forward<range_t>(p_range)));
+			}
+		};
+
+		template <typename type_t> struct is_adaptor_closure : std::false_type
+		{
+		};
+
+		template <typename pred_t> struct is_adaptor_closure<filter_adaptor::partial<pred_t>> : std::true_type
+		{
+		};
+
+		template <typename func_t> struct is_adaptor_closure<transform_adaptor::partial<func_t>> : std::true_type
+		{
+		};
+
+		template <> struct is_adaptor_closure<take_adaptor::partial> : std::true_type
+		{
+		};
+
+		template <> struct is_adaptor_closure<drop_adaptor::partial> : std::true_type
+		{
+		};
+
+		template <> struct is_adaptor_closure<enumerate_adaptor::partial> : std::true_type
+		{
+		};
+
+		template <> struct is_adaptor_closure<join_adaptor::partial> : std::true_type
+		{
+		};
+
+		template <> struct is_adaptor_closure<sort_adaptor::partial> : std::true_type
+		{
+		};
+
+		template <typename delimiter_t> struct is_adaptor_closure<join_with_adaptor::partial<delimiter_t>> : std::true_type
+		{
+		};
+
+		template <> struct is_adaptor_closure<unique_adaptor::partial> : std::true_type
+		{
+		};
+
+		template <> struct is_adaptor_closure<common_adaptor::partial> : std::true_type
+		{
+		};
+
+		template <> struct is_adaptor_closure<reverse_adaptor::partial> : std::true_type
+		{
+		};
+
+		template <typename first_t, typename second_t> struct is_adaptor_closure<pipeline<first_t, second_t>> : std::true_type
+		{
+		};
 	}	 // namespace views
 
 	template <typename container_t> inline auto end(const sorted_view<container_t>& p_view) -> typename sorted_view<container_t>::const_iterator
@@ -1712,6 +1822,416 @@ namespace ranges
 		return std::end(std::forward<range_t>(p_range));
 	}
 
+	namespace detail
+	{
+		namespace simd
+		{
+			// Generic kernels over contiguous arithmetic data. The independent
+			// accumulators break the loop-carried dependency so the compiler can keep
+			// several vector lanes in flight; explicit intrinsic overloads below cover
+			// the hot types when AVX2/SSE2 is available.
+			template <typename value_t> inline auto sum_contiguous(const value_t* p_data, std::size_t p_count) -> value_t
+			{
+				value_t acc0	= value_t(0);
+				value_t acc1	= value_t(0);
+				value_t acc2	= value_t(0);
+				value_t acc3	= value_t(0);
+				std::size_t idx = 0;
+				for (; idx + 4 <= p_count; idx += 4)
+				{
+					acc0 += p_data[idx];
+					acc1 += p_data[idx + 1];
+					acc2 += p_data[idx + 2];
+					acc3 += p_data[idx + 3];
+				}
+				for (; idx < p_count; ++idx)
+				{
+					acc0 += p_data[idx];
+				}
+				return (acc0 + acc1) + (acc2 + acc3);
+			}
+
+			template <typename value_t> inline auto min_contiguous(const value_t* p_data, std::size_t p_count) -> value_t
+			{
+				value_t best	= p_data[0];
+				std::size_t idx = 1;
+				for (; idx + 2 <= p_count; idx += 2)
+				{
+					const value_t lower = (p_data[idx] < p_data[idx + 1]) ? p_data[idx] : p_data[idx + 1];
+					if (lower < best)
+					{
+						best = lower;
+					}
+				}
+				for (; idx < p_count; ++idx)
+				{
+					if (p_data[idx] < best)
+					{
+						best = p_data[idx];
+					}
+				}
+				return best;
+			}
+
+			template <typename value_t> inline auto max_contiguous(const value_t* p_data, std::size_t p_count) -> value_t
+			{
+				value_t best	= p_data[0];
+				std::size_t idx = 1;
+				for (; idx + 2 <= p_count; idx += 2)
+				{
+					const value_t upper = (p_data[idx] < p_data[idx + 1]) ? p_data[idx + 1] : p_data[idx];
+					if (best < upper)
+					{
+						best = upper;
+					}
+				}
+				for (; idx < p_count; ++idx)
+				{
+					if (best < p_data[idx])
+					{
+						best = p_data[idx];
+					}
+				}
+				return best;
+			}
+
+			template <typename value_t> inline auto find_contiguous(const value_t* p_data, std::size_t p_count, const value_t& p_value) -> std::size_t
+			{
+				for (std::size_t idx = 0; idx < p_count; ++idx)
+				{
+					if (p_data[idx] == p_value)
+					{
+						return idx;
+					}
+				}
+				return p_count;
+			}
+
+			inline auto find_contiguous(const char* p_data, std::size_t p_count, const char& p_value) -> std::size_t
+			{
+				const void* hit = std::memchr(p_data, p_value, p_count);
+				return (hit != nullptr) ? static_cast<std::size_t>(static_cast<const char*>(hit) - p_data) : p_count;
+			}
+
+			inline auto find_contiguous(const unsigned char* p_data, std::size_t p_count, const unsigned char& p_value) -> std::size_t
+			{
+				const void* hit = std::memchr(p_data, p_value, p_count);
+				return (hit != nullptr) ? static_cast<std::size_t>(static_cast<const unsigned char*>(hit) - p_data) : p_count;
+			}
+
+			inline auto find_contiguous(const signed char* p_data, std::size_t p_count, const signed char& p_value) -> std::size_t
+			{
+				const void* hit = std::memchr(p_data, static_cast<int>(p_value), p_count);
+				return (hit != nullptr) ? static_cast<std::size_t>(static_cast<const signed char*>(hit) - p_data) : p_count;
+			}
+
+#if defined(__AVX2__)
+			inline auto sum_contiguous(const float* p_data, std::size_t p_count) -> float
+			{
+				__m256 acc		= _mm256_setzero_ps();
+				std::size_t idx = 0;
+				for (; idx + 8 <= p_count; idx += 8)
+				{
+					acc = _mm256_add_ps(acc, _mm256_loadu_ps(p_data + idx));
+				}
+				alignas(32) float lanes[8];
+				_mm256_store_ps(lanes, acc);
+				float result = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+				for (; idx < p_count; ++idx)
+				{
+					result += p_data[idx];
+				}
+				return result;
+			}
+
+			inline auto sum_contiguous(const double* p_data, std::size_t p_count) -> double
+			{
+				__m256d acc		= _mm256_setzero_pd();
+				std::size_t idx = 0;
+				for (; idx + 4 <= p_count; idx += 4)
+				{
+					acc = _mm256_add_pd(acc, _mm256_loadu_pd(p_data + idx));
+				}
+				alignas(32) double lanes[4];
+				_mm256_store_pd(lanes, acc);
+				double result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+				for (; idx < p_count; ++idx)
+				{
+					result += p_data[idx];
+				}
+				return result;
+			}
+
+			inline auto sum_contiguous(const std::int32_t* p_data, std::size_t p_count) -> std::int32_t
+			{
+				__m256i acc		= _mm256_setzero_si256();
+				std::size_t idx = 0;
+				for (; idx + 8 <= p_count; idx += 8)
+				{
+					acc = _mm256_add_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data + idx)));
+				}
+				alignas(32) std::int32_t lanes[8];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+				std::int32_t result = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+				for (; idx < p_count; ++idx)
+				{
+					result += p_data[idx];
+				}
+				return result;
+			}
+
+			inline auto sum_contiguous(const std::int64_t* p_data, std::size_t p_count) -> std::int64_t
+			{
+				__m256i acc		= _mm256_setzero_si256();
+				std::size_t idx = 0;
+				for (; idx + 4 <= p_count; idx += 4)
+				{
+					acc = _mm256_add_epi64(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data + idx)));
+				}
+				alignas(32) std::int64_t lanes[4];
+				_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+				std::int64_t result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+				for (; idx < p_count; ++idx)
+				{
+					result += p_data[idx];
+				}
+				return result;
+			}
+
+			inline auto min_contiguous(const float* p_data, std::size_t p_count) -> float
+			{
+				float best		= p_data[0];
+				std::size_t idx = 0;
+				if (p_count >= 8)
+				{
+					__m256 acc = _mm256_loadu_ps(p_data);
+					for (idx = 8; idx + 8 <= p_count; idx += 8)
+					{
+						acc = _mm256_min_ps(acc, _mm256_loadu_ps(p_data + idx));
+					}
+					alignas(32) float lanes[8];
+					_mm256_store_ps(lanes, acc);
+					best = lanes[0];
+					for (std::size_t lane = 1; lane < 8; ++lane)
+					{
+						best = (lanes[lane] < best) ? lanes[lane] : best;
+					}
+				}
+				for (; idx < p_count; ++idx)
+				{
+					best = (p_data[idx] < best) ? p_data[idx] : best;
+				}
+				return best;
+			}
+
+			inline auto max_contiguous(const float* p_data, std::size_t p_count) -> float
+			{
+				float best		= p_data[0];
+				std::size_t idx = 0;
+				if (p_count >= 8)
+				{
+					__m256 acc = _mm256_loadu_ps(p_data);
+					for (idx = 8; idx + 8 <= p_count; idx += 8)
+					{
+						acc = _mm256_max_ps(acc, _mm256_loadu_ps(p_data + idx));
+					}
+					alignas(32) float lanes[8];
+					_mm256_store_ps(lanes, acc);
+					best = lanes[0];
+					for (std::size_t lane = 1; lane < 8; ++lane)
+					{
+						best = (best < lanes[lane]) ? lanes[lane] : best;
+					}
+				}
+				for (; idx < p_count; ++idx)
+				{
+					best = (best < p_data[idx]) ? p_data[idx] : best;
+				}
+				return best;
+			}
+
+			inline auto min_contiguous(const std::int32_t* p_data, std::size_t p_count) -> std::int32_t
+			{
+				std::int32_t best = p_data[0];
+				std::size_t idx	  = 0;
+				if (p_count >= 8)
+				{
+					__m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data));
+					for (idx = 8; idx + 8 <= p_count; idx += 8)
+					{
+						acc = _mm256_min_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data + idx)));
+					}
+					alignas(32) std::int32_t lanes[8];
+					_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+					best = lanes[0];
+					for (std::size_t lane = 1; lane < 8; ++lane)
+					{
+						best = (lanes[lane] < best) ? lanes[lane] : best;
+					}
+				}
+				for (; idx < p_count; ++idx)
+				{
+					best = (p_data[idx] < best) ? p_data[idx] : best;
+				}
+				return best;
+			}
+
+			inline auto max_contiguous(const std::int32_t* p_data, std::size_t p_count) -> std::int32_t
+			{
+				std::int32_t best = p_data[0];
+				std::size_t idx	  = 0;
+				if (p_count >= 8)
+				{
+					__m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data));
+					for (idx = 8; idx + 8 <= p_count; idx += 8)
+					{
+						acc = _mm256_max_epi32(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data + idx)));
+					}
+					alignas(32) std::int32_t lanes[8];
+					_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+					best = lanes[0];
+					for (std::size_t lane = 1; lane < 8; ++lane)
+					{
+						best = (best < lanes[lane]) ? lanes[lane] : best;
+					}
+				}
+				for (; idx < p_count; ++idx)
+				{
+					best = (best < p_data[idx]) ? p_data[idx] : best;
+				}
+				return best;
+			}
+
+			inline auto find_contiguous(const std::int32_t* p_data, std::size_t p_count, const std::int32_t& p_value) -> std::size_t
+			{
+				const __m256i needle = _mm256_set1_epi32(p_value);
+				std::size_t idx		 = 0;
+				for (; idx + 8 <= p_count; idx += 8)
+				{
+					const __m256i hits = _mm256_cmpeq_epi32(needle, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_data + idx)));
+					const std::uint32_t mask = static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(hits)));
+					if (mask != 0)
+					{
+						return idx + static_cast<std::size_t>(__builtin_ctz(mask));
+					}
+				}
+				for (; idx < p_count; ++idx)
+				{
+					if (p_data[idx] == p_value)
+					{
+						return idx;
+					}
+				}
+				return p_count;
+			}
+#elif defined(__SSE2__)
+			inline auto sum_contiguous(const float* p_data, std::size_t p_count) -> float
+			{
+				__m128 acc		= _mm_setzero_ps();
+				std::size_t idx = 0;
+				for (; idx + 4 <= p_count; idx += 4)
+				{
+					acc = _mm_add_ps(acc, _mm_loadu_ps(p_data + idx));
+				}
+				alignas(16) float lanes[4];
+				_mm_store_ps(lanes, acc);
+				float result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+				for (; idx < p_count; ++idx)
+				{
+					result += p_data[idx];
+				}
+				return result;
+			}
+
+			inline auto sum_contiguous(const double* p_data, std::size_t p_count) -> double
+			{
+				__m128d acc		= _mm_setzero_pd();
+				std::size_t idx = 0;
+				for (; idx + 2 <= p_count; idx += 2)
+				{
+					acc = _mm_add_pd(acc, _mm_loadu_pd(p_data + idx));
+				}
+				alignas(16) double lanes[2];
+				_mm_store_pd(lanes, acc);
+				double result = lanes[0] + lanes[1];
+				for (; idx < p_count; ++idx)
+				{
+					result += p_data[idx];
+				}
+				return result;
+			}
+
+			inline auto min_contiguous(const float* p_data, std::size_t p_count) -> float
+			{
+				float best		= p_data[0];
+				std::size_t idx = 0;
+				if (p_count >= 4)
+				{
+					__m128 acc = _mm_loadu_ps(p_data);
+					for (idx = 4; idx + 4 <= p_count; idx += 4)
+					{
+						acc = _mm_min_ps(acc, _mm_loadu_ps(p_data + idx));
+					}
+					alignas(16) float lanes[4];
+					_mm_store_ps(lanes, acc);
+					best = lanes[0];
+					for (std::size_t lane = 1; lane < 4; ++lane)
+					{
+						best = (lanes[lane] < best) ? lanes[lane] : best;
+					}
+				}
+				for (; idx < p_count; ++idx)
+				{
+					best = (p_data[idx] < best) ? p_data[idx] : best;
+				}
+				return best;
+			}
+
+			inline auto max_contiguous(const float* p_data, std::size_t p_count) -> float
+			{
+				float best		= p_data[0];
+				std::size_t idx = 0;
+				if (p_count >= 4)
+				{
+					__m128 acc = _mm_loadu_ps(p_data);
+					for (idx = 4; idx + 4 <= p_count; idx += 4)
+					{
+						acc = _mm_max_ps(acc, _mm_loadu_ps(p_data + idx));
+					}
+					alignas(16) float lanes[4];
+					_mm_store_ps(lanes, acc);
+					best = lanes[0];
+					for (std::size_t lane = 1; lane < 4; ++lane)
+					{
+						best = (best < lanes[lane]) ? lanes[lane] : best;
+					}
+				}
+				for (; idx < p_count; ++idx)
+				{
+					best = (best < p_data[idx]) ? p_data[idx] : best;
+				}
+				return best;
+			}
+#endif
+
+			// A range qualifies for the kernels when it exposes contiguous storage of
+			// exactly the requested arithmetic type.
+			template <typename range_t, typename type_t, typename = void> struct is_kernel_range : std::false_type
+			{
+			};
+
+			template <typename range_t, typename type_t>
+			struct is_kernel_range<range_t, type_t, decltype(std::declval<range_t&>().data(), std::declval<range_t&>().size(), void())>
+				: std::integral_constant<bool,
+										 std::is_arithmetic<type_t>::value
+											 && std::is_same<typename std::remove_cv<typename std::remove_reference<decltype(*std::declval<
+																  range_t&>().data())>::type>::type,
+															 type_t>::value>
+			{
+			};
+		}	 // namespace simd
+	}	 // namespace detail
+
 	template <typename input_iter, typename func_t> inline auto for_each(input_iter p_first, input_iter p_last, func_t p_func) -> func_t
 	{
 		for (; p_first != p_last; ++p_first)
@@ -1744,10 +2264,27 @@ namespace ranges
 		return p_last;
 	}
 
+	namespace detail
+	{
+		template <typename range_t, typename type_t>
+		inline auto find_impl(range_t&& p_range, const type_t& p_value, std::true_type) -> range_iterator_t<range_t>
+		{
+			const std::size_t count = static_cast<std::size_t>(p_range.size());
+			return std::begin(p_range) + static_cast<range_difference_t<range_t>>(simd::find_contiguous(p_range.data(), count, p_value));
+		}
+
+		template <typename range_t, typename type_t>
+		inline auto find_impl(range_t&& p_range, const type_t& p_value, std::false_type) -> range_iterator_t<range_t>
+		{
+			return ranges::find(std::begin(p_range), std::end(p_range), p_value);
+		}
+	}	 // namespace detail
+
 	template <typename range_t, typename type_t, typename = typename std::enable_if<is_range<range_t>::value>::type>
 	inline auto find(range_t&& p_range, const type_t& p_value) -> range_iterator_t<range_t>
 	{
-		return ranges::find(std::begin(p_range), std::end(p_range), p_value);
+		return detail::find_impl(std::forward<range_t>(p_range), p_value,
+								 std::integral_constant<bool, detail::simd::is_kernel_range<remove_cvref_t<range_t>, remove_cvref_t<type_t>>::value>());
 	}
 
 	template <typename input_iter, typename pred_t> inline auto find_if(input_iter p_first, input_iter p_last, pred_t p_pred) -> input_iter
@@ -1997,19 +2534,347 @@ namespace ranges
 		ranges::reverse(std::begin(p_range), std::end(p_range));
 	}
 
-	template <typename random_iter> inline auto sort(random_iter p_first, random_iter p_last) -> void
+	namespace detail
 	{
-		std::sort(p_first, p_last);
+		namespace sort_impl
+		{
+			enum : std::size_t
+			{
+				k_insertion_threshold  = 24,
+				k_partial_insert_limit = 8,
+				k_radix_threshold	   = 512
+			};
+
+			template <typename random_iter, typename compare_t>
+			inline auto insertion_sort(random_iter p_first, random_iter p_last, compare_t p_comp) -> void
+			{
+				if (p_first == p_last)
+				{
+					return;
+				}
+				for (random_iter cur = p_first + 1; cur != p_last; ++cur)
+				{
+					iter_value_t<random_iter> value = std::move(*cur);
+					random_iter hole				= cur;
+					while (hole != p_first && p_comp(value, *(hole - 1)))
+					{
+						*hole = std::move(*(hole - 1));
+						--hole;
+					}
+					*hole = std::move(value);
+				}
+			}
+
+			// Insertion sort that gives up once it has shifted more than
+			// k_partial_insert_limit elements; cheaply finishes partitions that turned
+			// out to be almost sorted already.
+			template <typename random_iter, typename compare_t>
+			inline auto partial_insertion_sort(random_iter p_first, random_iter p_last, compare_t p_comp) -> bool
+			{
+				if (p_first == p_last)
+				{
+					return true;
+				}
+				std::size_t shifted = 0;
+				for (random_iter cur = p_first + 1; cur != p_last; ++cur)
+				{
+					iter_value_t<random_iter> value = std::move(*cur);
+					random_iter hole				= cur;
+					while (hole != p_first && p_comp(value, *(hole - 1)))
+					{
+						*hole = std::move(*(hole - 1));
+						--hole;
+						if (++shifted > k_partial_insert_limit)
+						{
+							*hole = std::move(value);
+							return false;
+						}
+					}
+					*hole = std::move(value);
+				}
+				return true;
+			}
+
+			template <typename random_iter, typename compare_t>
+			inline auto sort3(random_iter p_a, random_iter p_b, random_iter p_c, compare_t p_comp) -> void
+			{
+				if (p_comp(*p_b, *p_a))
+				{
+					std::iter_swap(p_a, p_b);
+				}
+				if (p_comp(*p_c, *p_b))
+				{
+					std::iter_swap(p_b, p_c);
+				}
+				if (p_comp(*p_b, *p_a))
+				{
+					std::iter_swap(p_a, p_b);
+				}
+			}
+
+			// Hoare partition with the pivot parked at p_first. Returns the final pivot
+			// position and whether the range was already partitioned (no swaps needed).
+			template <typename random_iter, typename compare_t>
+			inline auto partition_right(random_iter p_first, random_iter p_last, compare_t p_comp) -> std::pair<random_iter, bool>
+			{
+				iter_value_t<random_iter> pivot = std::move(*p_first);
+				random_iter left				= p_first;
+				random_iter right				= p_last;
+				bool already_partitioned		= true;
+				for (;;)
+				{
+					do
+					{
+						++left;
+					} while (left < p_last && p_comp(*left, pivot));
+					do
+					{
+						--right;
+					} while (p_comp(pivot, *right));
+					if (left >= right)
+					{
+						break;
+					}
+					std::iter_swap(left, right);
+					already_partitioned = false;
+				}
+				*p_first = std::move(*right);
+				*right	 = std::move(pivot);
+				return std::pair<random_iter, bool>(right, already_partitioned);
+			}
+
+			inline auto log2_floor(std::size_t p_value) -> std::size_t
+			{
+				std::size_t result = 0;
+				while (p_value >>= 1)
+				{
+					++result;
+				}
+				return result;
+			}
+
+			template <typename random_iter, typename compare_t>
+			inline auto pdqsort_loop(random_iter p_first, random_iter p_last, compare_t p_comp, std::size_t p_bad_allowed) -> void
+			{
+				for (;;)
+				{
+					const std::size_t size = static_cast<std::size_t>(p_last - p_first);
+					if (size < k_insertion_threshold)
+					{
+						insertion_sort(p_first, p_last, p_comp);
+						return;
+					}
+
+					// Median-of-three pivot moved to the front for partitioning.
+					random_iter mid = p_first + static_cast<iter_difference_t<random_iter>>(size / 2);
+					sort3(p_first, mid, p_last - 1, p_comp);
+					std::iter_swap(p_first, mid);
+
+					const std::pair<random_iter, bool> part = partition_right(p_first, p_last, p_comp);
+					random_iter pivot_pos					= part.first;
+
+					const std::size_t left_size	 = static_cast<std::size_t>(pivot_pos - p_first);
+					const std::size_t right_size = static_cast<std::size_t>(p_last - (pivot_pos + 1));
+					const bool highly_unbalanced = left_size < size / 8 || right_size < size / 8;
+
+					if (highly_unbalanced)
+					{
+						if (--p_bad_allowed == 0)
+						{
+							// Too many pathological partitions: fall back to heapsort to
+							// keep the worst case at O(n log n).
+							std::make_heap(p_first, p_last, p_comp);
+							std::sort_heap(p_first, p_last, p_comp);
+							return;
+						}
+						// Break up common adversarial patterns before continuing.
+						if (left_size >= k_insertion_threshold)
+						{
+							std::iter_swap(p_first, p_first + static_cast<iter_difference_t<random_iter>>(left_size / 4));
+							std::iter_swap(pivot_pos - 1, pivot_pos - static_cast<iter_difference_t<random_iter>>(left_size / 4));
+						}
+						if (right_size >= k_insertion_threshold)
+						{
+							std::iter_swap(pivot_pos + 1, pivot_pos + static_cast<iter_difference_t<random_iter>>(right_size / 4));
+							std::iter_swap(p_last - 1, p_last - static_cast<iter_difference_t<random_iter>>(right_size / 4));
+						}
+					}
+					else if (part.second && partial_insertion_sort(p_first, pivot_pos, p_comp)
+							 && partial_insertion_sort(pivot_pos + 1, p_last, p_comp))
+					{
+						return;
+					}
+
+					// Recurse into the smaller side, iterate on the larger one.
+					if (left_size < right_size)
+					{
+						pdqsort_loop(p_first, pivot_pos, p_comp, p_bad_allowed);
+						p_first = pivot_pos + 1;
+					}
+					else
+					{
+						pdqsort_loop(pivot_pos + 1, p_last, p_comp, p_bad_allowed);
+						p_last = pivot_pos;
+					}
+				}
+			}
+
+			template <typename random_iter, typename compare_t>
+			inline auto pdqsort(random_iter p_first, random_iter p_last, compare_t p_comp) -> void
+			{
+				const std::size_t size = static_cast<std::size_t>(p_last - p_first);
+				if (size < 2)
+				{
+					return;
+				}
+				pdqsort_loop(p_first, p_last, p_comp, log2_floor(size) + 1);
+			}
+
+			template <std::size_t byte_count> struct uint_for_size;
+
+			template <> struct uint_for_size<1>
+			{
+				using type = std::uint8_t;
+			};
+
+			template <> struct uint_for_size<2>
+			{
+				using type = std::uint16_t;
+			};
+
+			template <> struct uint_for_size<4>
+			{
+				using type = std::uint32_t;
+			};
+
+			template <> struct uint_for_size<8>
+			{
+				using type = std::uint64_t;
+			};
+
+			// Map a key onto an unsigned integer whose natural ordering matches the
+			// source type: signed integers get the sign bit flipped, floats use the
+			// usual sign-magnitude to two's-complement trick.
+			template <typename value_t>
+			inline auto radix_encode(value_t p_value, std::true_type /*integral*/) -> typename uint_for_size<sizeof(value_t)>::type
+			{
+				using key_t = typename uint_for_size<sizeof(value_t)>::type;
+				key_t key;
+				std::memcpy(&key, &p_value, sizeof(key));
+				if (std::is_signed<value_t>::value)
+				{
+					key = static_cast<key_t>(key ^ (static_cast<key_t>(1) << (sizeof(key_t) * 8 - 1)));
+				}
+				return key;
+			}
+
+			template <typename value_t>
+			inline auto radix_encode(value_t p_value, std::false_type /*floating*/) -> typename uint_for_size<sizeof(value_t)>::type
+			{
+				using key_t = typename uint_for_size<sizeof(value_t)>::type;
+				key_t key;
+				std::memcpy(&key, &p_value, sizeof(key));
+				const key_t sign_mask = static_cast<key_t>(1) << (sizeof(key_t) * 8 - 1);
+				return ((key & sign_mask) != 0) ? static_cast<key_t>(~key) : static_cast<key_t>(key | sign_mask);
+			}
+
+			template <typename value_t> inline auto radix_sort(value_t* p_data, std::size_t p_count) -> void
+			{
+				std::vector<value_t> buffer(p_count);
+				value_t* src			 = p_data;
+				value_t* dst			 = buffer.data();
+				const std::size_t passes = sizeof(value_t);
+				for (std::size_t pass = 0; pass < passes; ++pass)
+				{
+					const std::size_t shift = pass * 8;
+					std::size_t counts[256] = {0};
+					for (std::size_t idx = 0; idx < p_count; ++idx)
+					{
+						++counts[(radix_encode(src[idx], std::is_integral<value_t>()) >> shift) & 0xFFU];
+					}
+					// All keys share this digit: nothing to reorder for this pass.
+					if (counts[(radix_encode(src[0], std::is_integral<value_t>()) >> shift) & 0xFFU] == p_count)
+					{
+						continue;
+					}
+					std::size_t offset = 0;
+					for (std::size_t bucket = 0; bucket < 256; ++bucket)
+					{
+						const std::size_t count = counts[bucket];
+						counts[bucket]			= offset;
+						offset += count;
+					}
+					for (std::size_t idx = 0; idx < p_count; ++idx)
+					{
+						dst[counts[(radix_encode(src[idx], std::is_integral<value_t>()) >> shift) & 0xFFU]++] = src[idx];
+					}
+					std::swap(src, dst);
+				}
+				if (src != p_data)
+				{
+					std::copy(src, src + p_count, p_data);
+				}
+			}
+
+			template <typename iter_t, typename = void> struct is_radix_sortable : std::false_type
+			{
+			};
+
+			template <typename value_t>
+			struct is_radix_sortable<value_t*>
+				: std::integral_constant<bool,
+										 std::is_arithmetic<value_t>::value && !std::is_same<value_t, long double>::value
+											 && (sizeof(value_t) == 1 || sizeof(value_t) == 2 || sizeof(value_t) == 4 || sizeof(value_t) == 8)>
+			{
+			};
+
+			template <typename random_iter> inline auto sort_dispatch(random_iter p_first, random_iter p_last, std::true_type) -> void
+			{
+				const std::size_t count = static_cast<std::size_t>(p_last - p_first);
+				if (count >= k_radix_threshold)
+				{
+					radix_sort(p_first, count);
+					return;
+				}
+				pdqsort(p_first, p_last, std::less<iter_value_t<random_iter>>());
+			}
+
+			template <typename random_iter> inline auto sort_dispatch(random_iter p_first, random_iter p_last, std::false_type) -> void
+			{
+				pdqsort(p_first, p_last, std::less<iter_value_t<random_iter>>());
+			}
+		}	 // namespace sort_impl
+	}	 // namespace detail
+
+	template <typename random_iter> inline auto sort(random_iter p_first, random_iter p_last) -> void
+	{
+		detail::sort_impl::sort_dispatch(p_first, p_last,
+										 std::integral_constant<bool, detail::sort_impl::is_radix_sortable<random_iter>::value>());
 	}
 
+	namespace detail
+	{
+		template <typename range_t> inline auto sort_range_impl(range_t&& p_range, std::true_type) -> void
+		{
+			ranges::sort(p_range.data(), p_range.data() + p_range.size());
+		}
+
+		template <typename range_t> inline auto sort_range_impl(range_t&& p_range, std::false_type) -> void
+		{
+			ranges::sort(std::begin(p_range), std::end(p_range));
+		}
+	}	 // namespace detail
+
 	template <typename range_t, typename = typename std::enable_if<is_range<range_t>::value>::type> inline auto sort(range_t&& p_range) -> void
 	{
-		ranges::sort(std::begin(p_range), std::end(p_range));
+		detail::sort_range_impl(
+			std::forward<range_t>(p_range),
+			std::integral_constant<bool, detail::simd::is_kernel_range<remove_cvref_t<range_t>, range_value_t<remove_cvref_t<range_t>>>::value>());
 	}
 
 	template <typename random_iter, typename compare_t> inline auto sort(random_iter p_first, random_iter p_last, compare_t p_comp) -> void
 	{
-		std::sort(p_first, p_last, p_comp);
+		detail::sort_impl::pdqsort(p_first, p_last, p_comp);
 	}
 
 	template <typename range_t, typename compare_t, typename = typename std::enable_if<is_range<range_t>::value>::type>
@@ -2035,10 +2900,31 @@ namespace ranges
 		return smallest;
 	}
 
+	namespace detail
+	{
+		template <typename range_t> inline auto min_element_impl(range_t&& p_range, std::true_type) -> range_iterator_t<range_t>
+		{
+			const std::size_t count = static_cast<std::size_t>(p_range.size());
+			if (count == 0)
+			{
+				return std::end(p_range);
+			}
+			const auto best = simd::min_contiguous(p_range.data(), count);
+			return std::begin(p_range) + static_cast<range_difference_t<range_t>>(simd::find_contiguous(p_range.data(), count, best));
+		}
+
+		template <typename range_t> inline auto min_element_impl(range_t&& p_range, std::false_type) -> range_iterator_t<range_t>
+		{
+			return ranges::min_element(std::begin(p_range), std::end(p_range));
+		}
+	}	 // namespace detail
+
 	template <typename range_t, typename = typename std::enable_if<is_range<range_t>::value>::type>
 	inline auto min_element(range_t&& p_range) -> range_iterator_t<range_t>
 	{
-		return ranges::min_element(std::begin(p_range), std::end(p_range));
+		return detail::min_element_impl(
+			std::forward<range_t>(p_range),
+			std::integral_constant<bool, detail::simd::is_kernel_range<remove_cvref_t<range_t>, range_value_t<remove_cvref_t<range_t>>>::value>());
 	}
 
 	template <typename forward_iter, typename compare_t>
@@ -2078,10 +2964,31 @@ namespace ranges
 		return largest;
 	}
 
+	namespace detail
+	{
+		template <typename range_t> inline auto max_element_impl(range_t&& p_range, std::true_type) -> range_iterator_t<range_t>
+		{
+			const std::size_t count = static_cast<std::size_t>(p_range.size());
+			if (count == 0)
+			{
+				return std::end(p_range);
+			}
+			const auto best = simd::max_contiguous(p_range.data(), count);
+			return std::begin(p_range) + static_cast<range_difference_t<range_t>>(simd::find_contiguous(p_range.data(), count, best));
+		}
+
+		template <typename range_t> inline auto max_element_impl(range_t&& p_range, std::false_type) -> range_iterator_t<range_t>
+		{
+			return ranges::max_element(std::begin(p_range), std::end(p_range));
+		}
+	}	 // namespace detail
+
 	template <typename range_t, typename = typename std::enable_if<is_range<range_t>::value>::type>
 	inline auto max_element(range_t&& p_range) -> range_iterator_t<range_t>
 	{
-		return ranges::max_element(std::begin(p_range), std::end(p_range));
+		return detail::max_element_impl(
+			std::forward<range_t>(p_range),
+			std::integral_constant<bool, detail::simd::is_kernel_range<remove_cvref_t<range_t>, range_value_t<remove_cvref_t<range_t>>>::value>());
 	}
 
 	template <typename forward_iter, typename compare_t>
@@ -2166,10 +3073,29 @@ namespace ranges
 		return ranges::accumulate(p_first, p_last, p_init, std::plus<type_t>());
 	}
 
+	namespace detail
+	{
+		template <typename range_t, typename type_t> inline auto accumulate_impl(range_t&& p_range, type_t p_init, std::true_type) -> type_t
+		{
+			const std::size_t count = static_cast<std::size_t>(p_range.size());
+			if (count == 0)
+			{
+				return p_init;
+			}
+			return p_init + simd::sum_contiguous(p_range.data(), count);
+		}
+
+		template <typename range_t, typename type_t> inline auto accumulate_impl(range_t&& p_range, type_t p_init, std::false_type) -> type_t
+		{
+			return ranges::accumulate(std::begin(p_range), std::end(p_range), p_init);
+		}
+	}	 // namespace detail
+
 	template <typename range_t, typename type_t, typename = typename std::enable_if<is_range<range_t>::value>::type>
 	inline auto accumulate(range_t&& p_range, type_t p_init) -> type_t
 	{
-		return ranges::accumulate(std::begin(p_range), std::end(p_range), p_init);
+		return detail::accumulate_impl(std::forward<range_t>(p_range), p_init,
+									   std::integral_constant<bool, detail::simd::is_kernel_range<remove_cvref_t<range_t>, type_t>::value>());
 	}
 
 	template <typename range_t, typename type_t, typename binary_op_t, typename = typename std::enable_if<is_range<range_t>::value>::type>
@@ -3722,195 +4648,628 @@ namespace ranges
 	{
 		return views::to_partial<container_t>{};
 	}
+
+	namespace par
+	{
+		namespace detail
+		{
+			// The parallel overloads sit on the process-wide work-stealing
+			// scheduler: tasks run lazily started, fork-join waits help
+			// drain the pool, and exceptions propagate from wait().
+			using task_group = utils::task_scheduler::task_group;
+
+			// Below this element count the dispatch overhead outweighs the parallel gain.
+			enum : std::size_t
+			{
+				k_min_grain = 4096
+			};
+
+			inline auto grain_size(std::size_t p_count) -> std::size_t
+			{
+				// Aim for a handful of chunks per worker so uneven chunks still balance,
+				// but never drop below the sequential cutoff.
+				const std::size_t target_chunks = utils::task_scheduler::instance().worker_count() * 4;
+				const std::size_t grain			= (target_chunks > 0) ? p_count / target_chunks : p_count;
+				return std::max<std::size_t>(grain, k_min_grain);
+			}
+
+			inline auto should_run_sequential(std::size_t p_count) -> bool
+			{
+				return p_count < k_min_grain * 2 || utils::task_scheduler::instance().worker_count() < 2;
+			}
+		}	 // namespace detail
+
+		template <typename random_iter, typename func_t>
+		inline auto for_each(random_iter p_first, random_iter p_last, func_t p_func) ->
+			typename std::enable_if<is_random_access_iterator<random_iter>::value, func_t>::type
+		{
+			const std::size_t count = static_cast<std::size_t>(std::distance(p_first, p_last));
+			if (detail::should_run_sequential(count))
+			{
+				return ranges::for_each(p_first, p_last, p_func);
+			}
+
+			const std::size_t grain = detail::grain_size(count);
+			detail::task_group group;
+			for (std::size_t offset = 0; offset < count; offset += grain)
+			{
+				const std::size_t chunk_len = std::min(grain, count - offset);
+				random_iter chunk_first		= p_first + static_cast<iter_difference_t<random_iter>>(offset);
+				group.run([chunk_first, chunk_len, p_func]() { ranges::for_each(chunk_first, chunk_first + static_cast<iter_difference_t<random_iter>>(chunk_len), p_func); });
+			}
+			group.wait();
+			return p_func;
+		}
+
+		template <typename range_t, typename func_t, typename = typename std::enable_if<is_range<remove_cvref_t<range_t>>::value>::type>
+		inline auto for_each(range_t&& p_range, func_t p_func) -> func_t
+		{
+			return par::for_each(std::begin(p_range), std::end(p_range), p_func);
+		}
+
+		template <typename random_iter, typename output_iter, typename func_t>
+		inline auto transform(random_iter p_first, random_iter p_last, output_iter p_result, func_t p_func) ->
+			typename std::enable_if<is_random_access_iterator<random_iter>::value && is_random_access_iterator<output_iter>::value,
+									output_iter>::type
+		{
+			const std::size_t count = static_cast<std::size_t>(std::distance(p_first, p_last));
+			if (detail::should_run_sequential(count))
+			{
+				return std::transform(p_first, p_last, p_result, p_func);
+			}
+
+			const std::size_t grain = detail::grain_size(count);
+			detail::task_group group;
+			for (std::size_t offset = 0; offset < count; offset += grain)
+			{
+				const std::size_t chunk_len = std::min(grain, count - offset);
+				random_iter chunk_first		= p_first + static_cast<iter_difference_t<random_iter>>(offset);
+				output_iter chunk_result	= p_result + static_cast<iter_difference_t<output_iter>>(offset);
+				group.run(
+					[chunk_first, chunk_result, chunk_len, p_func]()
+					{ std::transform(chunk_first, chunk_first + static_cast<iter_difference_t<random_iter>>(chunk_len), chunk_result, p_func); });
+			}
+			group.wait();
+			return p_result + static_cast<iter_difference_t<output_iter>>(count);
+		}
+
+		template <typename range_t, typename output_iter, typename func_t, typename = typename std::enable_if<is_range<remove_cvref_t<range_t>>::value>::type>
+		inline auto transform(range_t&& p_range, output_iter p_result, func_t p_func) -> output_iter
+		{
+			return par::transform(std::begin(p_range), std::end(p_range), p_result, p_func);
+		}
+
+		// p_op must be associative; chunk results are combined in chunk order.
+		template <typename random_iter, typename type_t, typename binary_op_t>
+		inline auto reduce(random_iter p_first, random_iter p_last, type_t p_init, binary_op_t p_op) ->
+			typename std::enable_if<is_random_access_iterator<random_iter>::value, type_t>::type
+		{
+			const std::size_t count = static_cast<std::size_t>(std::distance(p_first, p_last));
+			if (detail::should_run_sequential(count))
+			{
+				return ranges::accumulate(p_first, p_last, p_init, p_op);
+			}
+
+			const std::size_t grain		  = detail::grain_size(count);
+			const std::size_t chunk_count = (count + grain - 1) / grain;
+			std::vector<type_t> partials(chunk_count, p_init);
+			detail::task_group group;
+			for (std::size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx)
+			{
+				const std::size_t offset	= chunk_idx * grain;
+				const std::size_t chunk_len = std::min(grain, count - offset);
+				random_iter chunk_first		= p_first + static_cast<iter_difference_t<random_iter>>(offset);
+				type_t* partial				= &partials[chunk_idx];
+				group.run(
+					[chunk_first, chunk_len, partial, p_op]()
+					{
+						random_iter chunk_last = chunk_first + static_cast<iter_difference_t<random_iter>>(chunk_len);
+						random_iter iter	   = chunk_first;
+						type_t result		   = *iter;
+						for (++iter; iter != chunk_last; ++iter)
+						{
+							result = p_op(result, *iter);
+						}
+						*partial = result;
+					});
+			}
+			group.wait();
+
+			type_t result = p_init;
+			for (std::size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx)
+			{
+				result = p_op(result, partials[chunk_idx]);
+			}
+			return result;
+		}
+
+		template <typename random_iter, typename type_t>
+		inline auto reduce(random_iter p_first, random_iter p_last, type_t p_init) ->
+			typename std::enable_if<is_random_access_iterator<random_iter>::value, type_t>::type
+		{
+			return par::reduce(p_first, p_last, p_init, std::plus<type_t>());
+		}
+
+		template <typename range_t, typename type_t, typename = typename std::enable_if<is_range<remove_cvref_t<range_t>>::value>::type>
+		inline auto reduce(range_t&& p_range, type_t p_init) -> type_t
+		{
+			return par::reduce(std::begin(p_range), std::end(p_range), p_init);
+		}
+
+		template <typename range_t, typename type_t, typename binary_op_t, typename = typename std::enable_if<is_range<remove_cvref_t<range_t>>::value>::type>
+		inline auto reduce(range_t&& p_range, type_t p_init, binary_op_t p_op) -> type_t
+		{
+			return par::reduce(std::begin(p_range), std::end(p_range), p_init, p_op);
+		}
+
+		namespace detail
+		{
+			template <typename random_iter, typename compare_t>
+			inline auto best_element(random_iter p_first, random_iter p_last, compare_t p_comp) -> random_iter
+			{
+				const std::size_t count = static_cast<std::size_t>(std::distance(p_first, p_last));
+				if (should_run_sequential(count))
+				{
+					return ranges::min_element(p_first, p_last, p_comp);
+				}
+
+				const std::size_t grain		  = grain_size(count);
+				const std::size_t chunk_count = (count + grain - 1) / grain;
+				std::vector<random_iter> bests(chunk_count, p_first);
+				task_group group;
+				for (std::size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx)
+				{
+					const std::size_t offset	= chunk_idx * grain;
+					const std::size_t chunk_len = std::min(grain, count - offset);
+					random_iter chunk_first		= p_first + static_cast<iter_difference_t<random_iter>>(offset);
+					random_iter* best			= &bests[chunk_idx];
+					group.run([chunk_first, chunk_len, best, p_comp]()
+							  { *best = ranges::min_element(chunk_first, chunk_first + static_cast<iter_difference_t<random_iter>>(chunk_len), p_comp); });
+				}
+				group.wait();
+
+				random_iter result = bests[0];
+				for (std::size_t chunk_idx = 1; chunk_idx < chunk_count; ++chunk_idx)
+				{
+					if (p_comp(*bests[chunk_idx], *result))
+					{
+						result = bests[chunk_idx];
+					}
+				}
+				return result;
+			}
+		}	 // namespace detail
+
+		template <typename random_iter, typename compare_t = std::less<iter_value_t<random_iter>>>
+		inline auto min_element(random_iter p_first, random_iter p_last, compare_t p_comp = compare_t()) ->
+			typename std::enable_if<is_random_access_iterator<random_iter>::value, random_iter>::type
+		{
+			if (p_first == p_last)
+			{
+				return p_last;
+			}
+			return detail::best_element(p_first, p_last, p_comp);
+		}
+
+		template <typename range_t, typename = typename std::enable_if<is_range<remove_cvref_t<range_t>>::value>::type>
+		inline auto min_element(range_t&& p_range) -> range_iterator_t<range_t>
+		{
+			return par::min_element(std::begin(p_range), std::end(p_range));
+		}
+
+		template <typename random_iter, typename compare_t = std::less<iter_value_t<random_iter>>>
+		inline auto max_element(random_iter p_first, random_iter p_last, compare_t p_comp = compare_t()) ->
+			typename std::enable_if<is_random_access_iterator<random_iter>::value, random_iter>::type
+		{
+			if (p_first == p_last)
+			{
+				return p_last;
+			}
+			struct inverted
+			{
+				compare_t m_comp;
+
+				inline auto operator()(const iter_value_t<random_iter>& p_lhs, const iter_value_t<random_iter>& p_rhs) const -> bool
+				{
+					return m_comp(p_rhs, p_lhs);
+				}
+			};
+			return detail::best_element(p_first, p_last, inverted{p_comp});
+		}
+
+		template <typename range_t, typename = typename std::enable_if<is_range<remove_cvref_t<range_t>>::value>::type>
+		inline auto max_element(range_t&& p_range) -> range_iterator_t<range_t>
+		{
+			return par::max_element(std::begin(p_range), std::end(p_range));
+		}
+
+		namespace detail
+		{
+			// Split on the calling thread until the segments reach the grain size, then
+			// hand each leaf to the pool. Waiting happens once at the top, never inside
+			// a worker, so the pool cannot deadlock on nested joins.
+			template <typename random_iter, typename compare_t>
+			inline auto sort_segments(random_iter p_first, random_iter p_last, compare_t p_comp, std::size_t p_grain, std::size_t p_depth,
+									  task_group& p_group) -> void
+			{
+				for (;;)
+				{
+					const std::size_t size = static_cast<std::size_t>(p_last - p_first);
+					if (size <= p_grain || p_depth == 0)
+					{
+						p_group.run([p_first, p_last, p_comp]() { ranges::detail::sort_impl::pdqsort(p_first, p_last, p_comp); });
+						return;
+					}
+
+					random_iter mid = p_first + static_cast<iter_difference_t<random_iter>>(size / 2);
+					ranges::detail::sort_impl::sort3(p_first, mid, p_last - 1, p_comp);
+					std::iter_swap(p_first, mid);
+					const std::pair<random_iter, bool> part = ranges::detail::sort_impl::partition_right(p_first, p_last, p_comp);
+					random_iter pivot_pos					= part.first;
+
+					--p_depth;
+					sort_segments(p_first, pivot_pos, p_comp, p_grain, p_depth, p_group);
+					p_first = pivot_pos + 1;
+				}
+			}
+		}	 // namespace detail
+
+		template <typename random_iter, typename compare_t>
+		inline auto sort(random_iter p_first, random_iter p_last, compare_t p_comp) ->
+			typename std::enable_if<is_random_access_iterator<random_iter>::value, void>::type
+		{
+			const std::size_t count = static_cast<std::size_t>(std::distance(p_first, p_last));
+			if (detail::should_run_sequential(count))
+			{
+				ranges::sort(p_first, p_last, p_comp);
+				return;
+			}
+
+			const std::size_t grain = detail::grain_size(count);
+			detail::task_group group;
+			detail::sort_segments(p_first, p_last, p_comp, grain, utils::task_scheduler::instance().worker_count() * 2 + 8, group);
+			group.wait();
+		}
+
+		template <typename random_iter>
+		inline auto sort(random_iter p_first, random_iter p_last) ->
+			typename std::enable_if<is_random_access_iterator<random_iter>::value, void>::type
+		{
+			par::sort(p_first, p_last, std::less<iter_value_t<random_iter>>());
+		}
+
+		template <typename range_t, typename = typename std::enable_if<is_range<remove_cvref_t<range_t>>::value>::type>
+		inline auto sort(range_t&& p_range) -> void
+		{
+			par::sort(std::begin(p_range), std::end(p_range));
+		}
+
+		template <typename range_t, typename compare_t, typename = typename std::enable_if<is_range<remove_cvref_t<range_t>>::value>::type>
+		inline auto sort(range_t&& p_range, compare_t p_comp) -> void
+		{
+			par::sort(std::begin(p_range), std::end(p_range), p_comp);
+		}
+
+		// Three parallel passes over equal chunks: count matches, scatter into a swap
+		// buffer at precomputed offsets, then copy back. Not in-place, but every pass
+		// scales with the worker count and element order within each side is kept.
+		template <typename random_iter, typename pred_t>
+		inline auto partition(random_iter p_first, random_iter p_last, pred_t p_pred) ->
+			typename std::enable_if<is_random_access_iterator<random_iter>::value, random_iter>::type
+		{
+			const std::size_t count = static_cast<std::size_t>(std::distance(p_first, p_last));
+			if (detail::should_run_sequential(count))
+			{
+				return std::partition(p_first, p_last, p_pred);
+			}
+
+			using value_t				  = iter_value_t<random_iter>;
+			const std::size_t grain		  = detail::grain_size(count);
+			const std::size_t chunk_count = (count + grain - 1) / grain;
+
+			std::vector<std::size_t> match_counts(chunk_count, 0);
+			{
+				detail::task_group group;
+				for (std::size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx)
+				{
+					const std::size_t offset	= chunk_idx * grain;
+					const std::size_t chunk_len = std::min(grain, count - offset);
+					random_iter chunk_first		= p_first + static_cast<iter_difference_t<random_iter>>(offset);
+					std::size_t* matches		= &match_counts[chunk_idx];
+					group.run(
+						[chunk_first, chunk_len, matches, p_pred]()
+						{
+							std::size_t hits = 0;
+							for (std::size_t idx = 0; idx < chunk_len; ++idx)
+							{
+								if (p_pred(*(chunk_first + static_cast<iter_difference_t<random_iter>>(idx))))
+								{
+									++hits;
+								}
+							}
+							*matches = hits;
+						});
+				}
+				group.wait();
+			}
+
+			std::size_t total_matches = 0;
+			std::vector<std::size_t> match_offsets(chunk_count, 0);
+			std::vector<std::size_t> miss_offsets(chunk_count, 0);
+			for (std::size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx)
+			{
+				match_offsets[chunk_idx] = total_matches;
+				total_matches += match_counts[chunk_idx];
+			}
+			std::size_t miss_cursor = total_matches;
+			for (std::size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx)
+			{
+				const std::size_t offset	= chunk_idx * grain;
+				const std::size_t chunk_len = std::min(grain, count - offset);
+				miss_offsets[chunk_idx]		= miss_cursor;
+				miss_cursor += chunk_len - match_counts[chunk_idx];
+			}
+
+			std::vector<value_t> buffer(count);
+			value_t* scatter = buffer.data();
+			{
+				detail::task_group group;
+				for (std::size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx)
+				{
+					const std::size_t offset	= chunk_idx * grain;
+					const std::size_t chunk_len = std::min(grain, count - offset);
+					random_iter chunk_first		= p_first + static_cast<iter_difference_t<random_iter>>(offset);
+					value_t* match_out			= scatter + match_offsets[chunk_idx];
+					value_t* miss_out			= scatter + miss_offsets[chunk_idx];
+					group.run(
+						[chunk_first, chunk_len, match_out, miss_out, p_pred]()
+						{
+							value_t* match_cursor = match_out;
+							value_t* miss_cursor  = miss_out;
+							for (std::size_t idx = 0; idx < chunk_len; ++idx)
+							{
+								random_iter cur = chunk_first + static_cast<iter_difference_t<random_iter>>(idx);
+								if (p_pred(*cur))
+								{
+									*match_cursor++ = std::move(*cur);
+								}
+								else
+								{
+									*miss_cursor++ = std::move(*cur);
+								}
+							}
+						});
+				}
+				group.wait();
+			}
+
+			{
+				detail::task_group group;
+				for (std::size_t chunk_idx = 0; chunk_idx < chunk_count; ++chunk_idx)
+				{
+					const std::size_t offset	= chunk_idx * grain;
+					const std::size_t chunk_len = std::min(grain, count - offset);
+					random_iter chunk_first		= p_first + static_cast<iter_difference_t<random_iter>>(offset);
+					value_t* chunk_src			= scatter + offset;
+					group.run([chunk_first, chunk_len, chunk_src]()
+							  { std::move(chunk_src, chunk_src + chunk_len, chunk_first); });
+				}
+				group.wait();
+			}
+
+			return p_first + static_cast<iter_difference_t<random_iter>>(total_matches);
+		}
+
+		template <typename range_t, typename pred_t, typename = typename std::enable_if<is_range<remove_cvref_t<range_t>>::value>::type>
+		inline auto partition(range_t&& p_range, pred_t p_pred) -> range_iterator_t<range_t>
+		{
+			return par::partition(std::begin(p_range), std::end(p_range), p_pred);
+		}
+	}	 // namespace par
 }	 // namespace ranges
 
-template <typename range_t, typename func_t>
+template <typename range_t, typename func_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const typename ranges::views::filter_adaptor::partial<func_t>& p_adaptor)
 	-> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t, typename func_t>
+template <typename range_t, typename func_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const typename ranges::views::filter_adaptor::partial<func_t>& p_adaptor)
 	-> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t, typename func_t>
+template <typename range_t, typename func_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const typename ranges::views::transform_adaptor::partial<func_t>& p_adaptor)
 	-> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t, typename func_t>
+template <typename range_t, typename func_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const typename ranges::views::transform_adaptor::partial<func_t>& p_adaptor)
 	-> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::take_adaptor::partial& p_adaptor) -> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::take_adaptor::partial& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::drop_adaptor::partial& p_adaptor) -> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::drop_adaptor::partial& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::sort_adaptor::partial& p_adaptor) -> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::sort_adaptor::partial& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::sort_adaptor& p_adaptor) -> decltype(p_adaptor()(std::forward<range_t>(p_range)))
 {
 	return p_adaptor()(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::sort_adaptor& p_adaptor) -> decltype(p_adaptor()(p_range))
 {
 	return p_adaptor()(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::unique_adaptor::partial& p_adaptor)
 	-> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::unique_adaptor::partial& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::unique_adaptor& p_adaptor) -> decltype(p_adaptor()(std::forward<range_t>(p_range)))
 {
 	return p_adaptor()(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::unique_adaptor& p_adaptor) -> decltype(p_adaptor()(p_range))
 {
 	return p_adaptor()(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::enumerate_adaptor::partial& p_adaptor)
 	-> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::enumerate_adaptor::partial& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::enumerate_adaptor& p_adaptor) -> decltype(p_adaptor()(std::forward<range_t>(p_range)))
 {
 	return p_adaptor()(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::enumerate_adaptor& p_adaptor) -> decltype(p_adaptor()(p_range))
 {
 	return p_adaptor()(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::join_adaptor::partial& p_adaptor) -> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::join_adaptor::partial& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::common_adaptor::partial& p_adaptor)
 	-> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::common_adaptor::partial& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::reverse_adaptor::partial& p_adaptor)
 	-> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t>
+template <typename range_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::reverse_adaptor::partial& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t, typename container_t>
+template <typename range_t, typename container_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::to_partial<container_t>& p_adaptor)
 	-> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t, typename container_t>
+template <typename range_t, typename container_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::to_partial<container_t>& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
 
-template <typename range_t, typename delimiter_t>
+template <typename range_t, typename delimiter_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(range_t&& p_range, const ranges::views::join_with_adaptor::partial<delimiter_t>& p_adaptor)
 	-> decltype(p_adaptor(std::forward<range_t>(p_range)))
 {
 	return p_adaptor(std::forward<range_t>(p_range));
 }
 
-template <typename range_t, typename delimiter_t>
+template <typename range_t, typename delimiter_t, typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
 inline auto operator|(const range_t& p_range, const ranges::views::join_with_adaptor::partial<delimiter_t>& p_adaptor) -> decltype(p_adaptor(p_range))
 {
 	return p_adaptor(p_range);
 }
+
+template <typename lhs_t, typename rhs_t,
+		  typename = typename std::enable_if<ranges::views::is_adaptor_closure<lhs_t>::value && ranges::views::is_adaptor_closure<rhs_t>::value>::type>
+inline auto operator|(lhs_t p_lhs, rhs_t p_rhs) -> ranges::views::pipeline<lhs_t, rhs_t>
+{
+	return ranges::views::pipeline<lhs_t, rhs_t>(std::move(p_lhs), std::move(p_rhs));
+}
+
+template <typename range_t, typename first_t, typename second_t,
+		  typename = typename std::enable_if<ranges::is_range<ranges::remove_cvref_t<range_t>>::value>::type>
+inline auto operator|(range_t&& p_range, const ranges::views::pipeline<first_t, second_t>& p_pipeline)
+	-> decltype(p_pipeline(std::forward<range_t>(p_range)))
+{
+	return p_pipeline(std::forward<range_t>(p_range));
+}
 #endif
@@ -0,0 +1,331 @@
+#pragma once
+#ifndef SMALL_VECTOR_HPP
+	#define SMALL_VECTOR_HPP
+
+	#include <cassert>
+	#include <cstddef>
+	#include <initializer_list>
+	#include <iterator>
+	#include <memory>
+	#include <stdexcept>
+	#include <type_traits>
+	#include <utility>
+
+namespace utils
+{
+	/**
+	 * @brief Vector with inline storage for the first inline_n elements
+	 *
+	 * Elements live in a buffer embedded in the object until the size exceeds
+	 * inline_n, at which point storage spills to the heap through the
+	 * allocator and stays there. Hot stack-shaped containers (profiler scope
+	 * stacks, captured frames, per-call argument lists) rarely exceed a small
+	 * bound, so sizing inline_n to the common case removes the allocation
+	 * from scope entry entirely.
+	 *
+	 * Deviations from std::vector: growth never returns to inline storage,
+	 * move construction from a spilled vector steals the heap buffer but an
+	 * inline one moves element-wise (so moved-from inline elements are
+	 * moved-from, not gone), and only the vector operations the library
+	 * actually uses are provided.
+	 */
+	template <typename element_t, std::size_t inline_n, typename allocator_t = std::allocator<element_t> > class small_vector
+	{
+	public:
+		using self_t		  = small_vector<element_t, inline_n, allocator_t>;
+		using value_type	  = element_t;
+		using size_type		  = std::size_t;
+		using reference		  = element_t&;
+		using const_reference = const element_t&;
+		using iterator		  = element_t*;
+		using const_iterator  = const element_t*;
+		using allocator_type  = allocator_t;
+
+		static const size_type inline_capacity = inline_n;
+
+	private:
+		using alloc_traits = std::allocator_traits<allocator_t>;
+
+		alignas(element_t) unsigned char m_inline[sizeof(element_t) * inline_n];
+		element_t* m_data;
+		size_type m_size;
+		size_type m_capacity;
+		allocator_t m_alloc;
+
+	public:
+		~small_vector()
+		{
+			destroy_range(0, m_size);
+			release_heap();
+		}
+
+		small_vector() : m_data(inline_data()), m_size(0), m_capacity(inline_n) {}
+
+		explicit small_vector(const allocator_t& p_alloc) : m_data(inline_data()), m_size(0), m_capacity(inline_n), m_alloc(p_alloc) {}
+
+		explicit small_vector(size_type p_count, const element_t& p_value = element_t()) : m_data(inline_data()), m_size(0), m_capacity(inline_n)
+		{
+			reserve(p_count);
+			for (size_type idx_for = 0; idx_for < p_count; ++idx_for)
+			{
+				alloc_traits::construct(m_alloc, m_data + idx_for, p_value);
+			}
+			m_size = p_count;
+		}
+
+		small_vector(std::initializer_list<element_t> p_init) : m_data(inline_data()), m_size(0), m_capacity(inline_n)
+		{
+			assign(p_init.begin(), p_init.end());
+		}
+
+		small_vector(const self_t& p_other) : m_data(inline_data()), m_size(0), m_capacity(inline_n), m_alloc(p_other.m_alloc)
+		{
+			assign(p_other.begin(), p_other.end());
+		}
+
+		auto operator=(const self_t& p_other) -> self_t&
+		{
+			if (this != &p_other)
+			{
+				assign(p_other.begin(), p_other.end());
+			}
+			return *this;
+		}
+
+		small_vector(self_t&& p_other) noexcept(std::is_nothrow_move_constructible<element_t>::value)
+			: m_data(inline_data()), m_size(0), m_capacity(inline_n), m_alloc(std::move(p_other.m_alloc))
+		{
+			take_contents(p_other);
+		}
+
+		auto operator=(self_t&& p_other) noexcept(std::is_nothrow_move_constructible<element_t>::value) -> self_t&
+		{
+			if (this != &p_other)
+			{
+				destroy_range(0, m_size);
+				release_heap();
+				m_data	   = inline_data();
+				m_size	   = 0;
+				m_capacity = inline_n;
+				m_alloc	   = std::move(p_other.m_alloc);
+				take_contents(p_other);
+			}
+			return *this;
+		}
+
+	public:
+		auto size() const noexcept -> size_type { return m_size; }
+
+		auto empty() const noexcept -> bool { return m_size == 0; }
+
+		auto capacity() const noexcept -> size_type { return m_capacity; }
+
+		// True while elements still live in the embedded buffer
+		auto is_inline() const noexcept -> bool { return m_data == inline_data(); }
+
+		auto data() noexcept -> element_t* { return m_data; }
+
+		auto data() const noexcept -> const element_t* { return m_data; }
+
+		auto begin() noexcept -> iterator { return m_data; }
+
+		auto begin() const noexcept -> const_iterator { return m_data; }
+
+		auto end() noexcept -> iterator { return m_data + m_size; }
+
+		auto end() const noexcept -> const_iterator { return m_data + m_size; }
+
+		auto operator[](size_type p_index) -> reference
+		{
+			assert(p_index < m_size);
+			return m_data[p_index];
+		}
+
+		auto operator[](size_type p_index) const -> const_reference
+		{
+			assert(p_index < m_size);
+			return m_data[p_index];
+		}
+
+		auto at(size_type p_index) -> reference
+		{
+			if (p_index >= m_size)
+			{
+				throw std::out_of_range("small_vector::at: index out of range");
+			}
+			return m_data[p_index];
+		}
+
+		auto at(size_type p_index) const -> const_reference { return const_cast<self_t*>(this)->at(p_index); }
+
+		auto front() -> reference { return (*this)[0]; }
+
+		auto front() const -> const_reference { return (*this)[0]; }
+
+		auto back() -> reference { return (*this)[m_size - 1]; }
+
+		auto back() const -> const_reference { return (*this)[m_size - 1]; }
+
+	public:
+		auto reserve(size_type p_count) -> void
+		{
+			if (p_count > m_capacity)
+			{
+				grow_to(p_count);
+			}
+		}
+
+		auto push_back(const element_t& p_value) -> void
+		{
+			ensure_room();
+			alloc_traits::construct(m_alloc, m_data + m_size, p_value);
+			++m_size;
+		}
+
+		auto push_back(element_t&& p_value) -> void
+		{
+			ensure_room();
+			alloc_traits::construct(m_alloc, m_data + m_size, std::move(p_value));
+			++m_size;
+		}
+
+		template <typename... args_t> auto emplace_back(args_t&&... p_args) -> reference
+		{
+			ensure_room();
+			alloc_traits::construct(m_alloc, m_data + m_size, std::forward<args_t>(p_args)...);
+			++m_size;
+			return m_data[m_size - 1];
+		}
+
+		auto pop_back() -> void
+		{
+			assert(m_size > 0);
+			--m_size;
+			alloc_traits::destroy(m_alloc, m_data + m_size);
+		}
+
+		auto clear() noexcept -> void
+		{
+			destroy_range(0, m_size);
+			m_size = 0;
+		}
+
+		auto resize(size_type p_count) -> void
+		{
+			if (p_count < m_size)
+			{
+				destroy_range(p_count, m_size);
+			}
+			else if (p_count > m_size)
+			{
+				reserve(p_count);
+				for (size_type idx_for = m_size; idx_for < p_count; ++idx_for)
+				{
+					alloc_traits::construct(m_alloc, m_data + idx_for);
+				}
+			}
+			m_size = p_count;
+		}
+
+		template <typename input_it_t> auto assign(input_it_t p_first, input_it_t p_last) -> void
+		{
+			clear();
+			const size_type count = static_cast<size_type>(std::distance(p_first, p_last));
+			reserve(count);
+			for (; p_first != p_last; ++p_first)
+			{
+				alloc_traits::construct(m_alloc, m_data + m_size, *p_first);
+				++m_size;
+			}
+		}
+
+		auto erase(iterator p_pos) -> iterator
+		{
+			assert(p_pos >= begin() && p_pos < end());
+			for (iterator it = p_pos; it + 1 != end(); ++it)
+			{
+				*it = std::move(*(it + 1));
+			}
+			pop_back();
+			return p_pos;
+		}
+
+	private:
+		auto inline_data() noexcept -> element_t* { return reinterpret_cast<element_t*>(m_inline); }
+
+		auto inline_data() const noexcept -> const element_t* { return reinterpret_cast<const element_t*>(m_inline); }
+
+		auto ensure_room() -> void
+		{
+			if (m_size == m_capacity)
+			{
+				grow_to(m_capacity * 2);
+			}
+		}
+
+		// Moves elements into a fresh heap block; never shrinks back inline
+		auto grow_to(size_type p_new_capacity) -> void
+		{
+			if (p_new_capacity < m_capacity * 2)
+			{
+				p_new_capacity = m_capacity * 2;
+			}
+
+			element_t* new_data = alloc_traits::allocate(m_alloc, p_new_capacity);
+			for (size_type idx_for = 0; idx_for < m_size; ++idx_for)
+			{
+				alloc_traits::construct(m_alloc, new_data + idx_for, std::move_if_noexcept(m_data[idx_for]));
+			}
+			destroy_range(0, m_size);
+			release_heap();
+			m_data	   = new_data;
+			m_capacity = p_new_capacity;
+		}
+
+		auto destroy_range(size_type p_first, size_type p_last) noexcept -> void
+		{
+			for (size_type idx_for = p_first; idx_for < p_last; ++idx_for)
+			{
+				alloc_traits::destroy(m_alloc, m_data + idx_for);
+			}
+		}
+
+		auto release_heap() noexcept -> void
+		{
+			if (!is_inline())
+			{
+				alloc_traits::deallocate(m_alloc, m_data, m_capacity);
+			}
+		}
+
+		// Steals the heap buffer when p_other spilled, moves element-wise
+		// when its elements are still inline
+		auto take_contents(self_t& p_other) -> void
+		{
+			if (p_other.is_inline())
+			{
+				reserve(p_other.m_size);
+				for (size_type idx_for = 0; idx_for < p_other.m_size; ++idx_for)
+				{
+					alloc_traits::construct(m_alloc, m_data + idx_for, std::move(p_other.m_data[idx_for]));
+				}
+				m_size = p_other.m_size;
+				p_other.clear();
+			}
+			else
+			{
+				m_data				= p_other.m_data;
+				m_size				= p_other.m_size;
+				m_capacity			= p_other.m_capacity;
+				p_other.m_data		= p_other.inline_data();
+				p_other.m_size		= 0;
+				p_other.m_capacity	= inline_n;
+			}
+		}
+	};
+
+	template <typename element_t, std::size_t inline_n, typename allocator_t>
+	const typename small_vector<element_t, inline_n, allocator_t>::size_type small_vector<element_t, inline_n, allocator_t>::inline_capacity;
+}	 // namespace utils
+
+#endif	  // SMALL_VECTOR_HPP
@@ -18,11 +18,17 @@
 
 	// Linux-specific includes for backtrace
 	#ifdef __linux__
+		#include <cxxabi.h>
+		#include <dlfcn.h>
 		#include <execinfo.h>
 		#include <signal.h>
 		#include <unistd.h>
 	#endif
 
+	#include <map>
+
+	#include "small_vector.hpp"
+
 	// Convenience macro for pushing stack frames
 	#define PUSH_STACK_TRACE(trace) trace.push_stack(__PRETTY_FUNCTION__, __LINE__, __FILE__)
 
@@ -65,7 +71,8 @@ namespace global_utils
 
 	private:
 		// Member variables
-		std::vector<stack_frame> m_stack;
+		utils::small_vector<stack_frame, 16> m_stack;
+		utils::small_vector<void*, 64> m_raw_frames;
 		bool m_dump_on_destroy = false;
 
 		// utils::process m_process;
@@ -74,7 +81,7 @@ namespace global_utils
 		// Destructor
 		~stack_trace()
 		{
-			if (m_dump_on_destroy && !m_stack.empty())
+			if (m_dump_on_destroy && (!m_stack.empty() || !m_raw_frames.empty()))
 			{
 				dump_stack();
 			}
@@ -90,7 +97,8 @@ namespace global_utils
 		auto operator=(const self_t&) -> self_t& = delete;
 
 		// Move constructor and assignment operator
-		stack_trace(self_t&& p_other) noexcept : m_stack(std::move(p_other.m_stack)), m_dump_on_destroy(p_other.m_dump_on_destroy)
+		stack_trace(self_t&& p_other) noexcept
+			: m_stack(std::move(p_other.m_stack)), m_raw_frames(std::move(p_other.m_raw_frames)), m_dump_on_destroy(p_other.m_dump_on_destroy)
 		{
 			p_other.m_dump_on_destroy = false;	  // Prevent double dump
 		}
@@ -100,6 +108,7 @@ namespace global_utils
 			if (this != &p_other)
 			{
 				m_stack					  = std::move(p_other.m_stack);
+				m_raw_frames			  = std::move(p_other.m_raw_frames);
 				m_dump_on_destroy		  = p_other.m_dump_on_destroy;
 				p_other.m_dump_on_destroy = false;	  // Prevent double dump
 			}
@@ -110,30 +119,85 @@ namespace global_utils
 		// Public methods
 		auto push_stack(const char* p_function, std::int32_t p_line, const char* p_file) -> void { m_stack.emplace_back(p_function, p_line, p_file); }
 
+		// Captures the current call stack as raw instruction pointers only; no
+		// string work, no subprocesses, no symbol lookups. Cheap enough for
+		// frequent error paths - symbolization happens lazily in dump_stack,
+		// and only for traces that are actually printed.
+		auto capture(std::int32_t p_skip = 1) -> std::int32_t
+		{
+	#ifdef __linux__
+			constexpr std::int32_t max_frames = 64;
+			void* buffer[max_frames];
+
+			std::int32_t frame_count = backtrace(buffer, max_frames);
+
+			// Frame 0 is capture itself; p_skip hides it plus any wrappers the
+			// caller wants dropped (0 keeps everything)
+			std::int32_t first = (p_skip > 0 ? p_skip : 0);
+			if (frame_count <= first)
+			{
+				m_raw_frames.clear();
+				return 0;
+			}
+
+			m_raw_frames.assign(&buffer[first], &buffer[frame_count]);
+			return frame_count - first;
+	#else
+			return 0;
+	#endif
+		}
+
+		auto captured_size() const -> std::size_t { return m_raw_frames.size(); }
+
 		auto dump_stack() const -> void
 		{
-			if (m_stack.empty())
+			if (m_stack.empty() && m_raw_frames.empty())
 			{
 				print_helper(std::cout, "Stack trace is empty\n");
 				return;
 			}
 
-			print_helper(std::cout, "=== Stack Trace (", m_stack.size(), " frames) ===\n");
+			if (!m_stack.empty())
+			{
+				print_helper(std::cout, "=== Stack Trace (", m_stack.size(), " frames) ===\n");
+
+				std::size_t idx_for = 0;
+				for (const auto& frame : m_stack)
+				{
+					std::string filename = frame.m_file;
+					auto last_slash		 = filename.find_last_of("/\\");
+					if (last_slash != std::string::npos)
+						filename = filename.substr(last_slash + 1);
+
+					print_helper(std::cout, "  #", idx_for++, ": ", frame.m_function, " at ", filename, ":", frame.m_line, '\n');
+				}
+				print_helper(std::cout, "=== End Stack Trace ===\n");
+			}
 
-			std::size_t idx_for = 0;
-			for (const auto& frame : m_stack)
+			if (!m_raw_frames.empty())
 			{
-				std::string filename = frame.m_file;
-				auto last_slash		 = filename.find_last_of("/\\");
-				if (last_slash != std::string::npos)
-					filename = filename.substr(last_slash + 1);
+				print_helper(std::cout, "=== Captured Stack (", m_raw_frames.size(), " frames) ===\n");
 
-				print_helper(std::cout, "  #", idx_for++, ": ", frame.m_function, " at ", filename, ":", frame.m_line, '\n');
+				for (std::size_t idx_for = 0; idx_for < m_raw_frames.size(); ++idx_for)
+				{
+					stack_frame frame = symbolize_address(m_raw_frames[idx_for]);
+
+					std::string filename = frame.m_file;
+					auto last_slash		 = filename.find_last_of("/\\");
+					if (last_slash != std::string::npos)
+						filename = filename.substr(last_slash + 1);
+
+					print_helper(std::cout, "  #", idx_for, ": ", frame.m_function, " at ", filename, '\n');
+				}
+				print_helper(std::cout, "=== End Captured Stack ===\n");
 			}
-			print_helper(std::cout, "=== End Stack Trace ===\n");
 		}
 
-		auto clear_stack() -> void { m_stack.clear(); }
+		auto clear_stack() -> void
+		{
+			m_stack.clear();
+			m_raw_frames.clear();
+		}
 
 		auto size() const -> std::size_t { return m_stack.size(); }
 
@@ -203,6 +267,71 @@ namespace global_utils
 	#endif
 		}
 
+		// Symbolizes one captured instruction pointer via dladdr (in-process,
+		// no addr2line subprocess) with __cxa_demangle for C++ names. Results
+		// are cached per address so repeated dumps of the same error path only
+		// pay the lookup once.
+		static auto symbolize_address(void* p_address) -> stack_frame
+		{
+	#ifdef __linux__
+			static std::mutex cache_mutex;
+			static std::map<void*, stack_frame> cache;
+
+			{
+				std::lock_guard<std::mutex> lk(cache_mutex);
+				auto it = cache.find(p_address);
+				if (it != cache.end())
+				{
+					return it->second;
+				}
+			}
+
+			std::string function_name = "??";
+			std::string module_name	  = "??";
+
+			Dl_info info;
+			std::memset(&info, 0, sizeof(info));
+			if (dladdr(p_address, &info) != 0)
+			{
+				if (info.dli_fname != nullptr && info.dli_fname[0] != '\0')
+				{
+					module_name = info.dli_fname;
+				}
+				if (info.dli_sname != nullptr)
+				{
+					function_name = info.dli_sname;
+
+					std::int32_t status = 0;
+					char* demangled		= abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+					if (status == 0 && demangled != nullptr)
+					{
+						function_name = demangled;
+					}
+					std::free(static_cast<void*>(demangled));
+				}
+			}
+
+			// No symbol: at least show the raw address so the frame stays useful
+			if (function_name == "??")
+			{
+				std::ostringstream os;
+				os << "?? [0x" << std::hex << reinterpret_cast<uintptr_t>(p_address) << "]";
+				function_name = os.str();
+			}
+
+			stack_frame frame(function_name.c_str(), 0, module_name.c_str());
+
+			{
+				std::lock_guard<std::mutex> lk(cache_mutex);
+				cache.insert({p_address, frame});
+			}
+
+			return frame;
+	#else
+			return stack_frame("??", 0, "??");
+	#endif
+		}
+
 		auto get_executable_path() -> std::string
 		{
 	#ifdef __linux__
@@ -8,23 +8,46 @@
 #ifndef STATISTICS_HPP
 	#define STATISTICS_HPP
 
+	#include <algorithm>
 	#include <cmath>
 	#include <cstdint>
 	#include <limits>
 	#include <string>
 	#include <vector>
 
+	#include "cspan.hpp"
 	#include "expected.hpp"
 	#include "ranges.hpp"
 
 namespace utils
 {
 
+	/**
+	 * @brief Storage policy that retains every sample in a vector
+	 */
+	struct retained_policy
+	{
+	};
+
+	/**
+	 * @brief Storage policy that folds samples into running moments (Welford)
+	 */
+	struct streaming_policy
+	{
+	};
+
 	/**
 	 * @brief Generic averager for statistical calculations
 	 * @tparam value_t Type of values to average
+	 * @tparam policy_t Storage policy (retained_policy or streaming_policy)
+	 */
+	template <typename value_t, typename policy_t = retained_policy> class averager;
+
+	/**
+	 * @brief Sample-retaining averager; keeps samples for replay at the cost of O(n) memory
+	 * @tparam value_t Type of values to average
 	 */
-	template <typename value_t> class averager
+	template <typename value_t> class averager<value_t, retained_policy>
 	{
 	public:
 		// Type aliases
@@ -80,6 +103,41 @@ namespace utils
 			invalidate_cache();
 		}
 
+		/**
+		 * @brief Add a block of samples in one pass
+		 * @param p_samples Span of sample values to add
+		 */
+		auto add_samples(cspan<const val_t> p_samples) -> void
+		{
+			if (p_samples.size() == 0)
+			{
+				return;
+			}
+
+			if (m_samples.size() + p_samples.size() <= m_max_samples)
+			{
+				m_samples.insert(m_samples.end(), p_samples.data(), p_samples.data() + p_samples.size());
+				m_cur_idx = static_cast<std::uint32_t>(m_samples.size() % m_max_samples);
+			}
+			else
+			{
+				for (std::size_t idx_for = 0; idx_for < p_samples.size(); ++idx_for)
+				{
+					if (m_samples.size() < m_max_samples)
+					{
+						m_samples.push_back(p_samples[idx_for]);
+					}
+					else
+					{
+						m_samples[m_cur_idx] = p_samples[idx_for];
+					}
+					m_cur_idx = (m_cur_idx + 1) % m_max_samples;
+				}
+			}
+
+			invalidate_cache();
+		}
+
 		/**
 		 * @brief Get average of samples
 		 * @return Expected containing average or error
@@ -310,6 +368,526 @@ namespace utils
 		}
 	};
 
+	/**
+	 * @brief Streaming averager using Welford's online algorithm
+	 *
+	 * Holds only the running count, mean, M2, sum, min and max, so memory stays
+	 * constant no matter how many samples are fed in and every accessor is O(1).
+	 * Samples are not retained; get_samples() is intentionally absent.
+	 *
+	 * @tparam value_t Type of values to average
+	 */
+	template <typename value_t> class averager<value_t, streaming_policy>
+	{
+	public:
+		// Type aliases
+		using self_t	 = averager;
+		using val_t		 = value_t;
+		using val_cref_t = const value_t&;
+		using size_t	 = std::size_t;
+
+	private:
+		// Member variables
+		std::size_t m_count = 0;
+		double m_mean		= 0.0;
+		double m_m2			= 0.0;
+
+		val_t m_sum = val_t(0);
+		val_t m_min = val_t(0);
+		val_t m_max = val_t(0);
+
+	public:
+		/**
+		 * @brief Default constructor
+		 */
+		averager() noexcept = default;
+
+		/**
+		 * @brief Constructor with sample count (accepted for drop-in parity, unused)
+		 * @param p_sample_cnt Ignored; the streaming policy never stores samples
+		 */
+		explicit averager(std::uint32_t p_sample_cnt) noexcept { static_cast<void>(p_sample_cnt); }
+
+	public:
+		/**
+		 * @brief Fold sample value into the running moments
+		 * @param p_sample Sample value to add
+		 */
+		auto add_sample(val_cref_t p_sample) noexcept -> void
+		{
+			if (m_count == 0)
+			{
+				m_min = p_sample;
+				m_max = p_sample;
+			}
+			else
+			{
+				if (p_sample < m_min)
+				{
+					m_min = p_sample;
+				}
+				if (m_max < p_sample)
+				{
+					m_max = p_sample;
+				}
+			}
+
+			++m_count;
+			m_sum += p_sample;
+
+			const double delta = static_cast<double>(p_sample) - m_mean;
+			m_mean += delta / static_cast<double>(m_count);
+			m_m2 += delta * (static_cast<double>(p_sample) - m_mean);
+		}
+
+		/**
+		 * @brief Fold a block of samples into the running moments in one pass
+		 *
+		 * Block sum/min/max go through the vectorized ranges kernels, the block
+		 * M2 is a straight-line two-pass loop, and the result is merged with the
+		 * running moments via the parallel-variance (Chan) combination.
+		 *
+		 * @param p_samples Span of sample values to add
+		 */
+		auto add_samples(cspan<const val_t> p_samples) noexcept -> void
+		{
+			const std::size_t block_count = p_samples.size();
+			if (block_count == 0)
+			{
+				return;
+			}
+
+			const val_t block_sum = ranges::accumulate(p_samples, val_t(0));
+			const val_t block_min = *ranges::min_element(p_samples);
+			const val_t block_max = *ranges::max_element(p_samples);
+
+			const double block_mean = static_cast<double>(block_sum) / static_cast<double>(block_count);
+			double block_m2			= 0.0;
+			const val_t* data		= p_samples.data();
+			for (std::size_t idx_for = 0; idx_for < block_count; ++idx_for)
+			{
+				const double delta = static_cast<double>(data[idx_for]) - block_mean;
+				block_m2 += delta * delta;
+			}
+
+			if (m_count == 0)
+			{
+				m_min = block_min;
+				m_max = block_max;
+			}
+			else
+			{
+				if (block_min < m_min)
+				{
+					m_min = block_min;
+				}
+				if (m_max < block_max)
+				{
+					m_max = block_max;
+				}
+			}
+
+			const double total = static_cast<double>(m_count) + static_cast<double>(block_count);
+			const double delta = block_mean - m_mean;
+			m_m2 += block_m2 + (delta * delta * static_cast<double>(m_count) * static_cast<double>(block_count) / total);
+			m_mean += delta * static_cast<double>(block_count) / total;
+			m_count += block_count;
+			m_sum += block_sum;
+		}
+
+		/**
+		 * @brief Get running average
+		 * @return Expected containing average or error
+		 */
+		auto get_avg() const noexcept -> utils::expected<val_t, std::string>
+		{
+			if (m_count == 0)
+			{
+				return utils::make_unexpected(std::string("No samples"));
+			}
+
+			return val_t(m_mean);
+		}
+
+		/**
+		 * @brief Get minimum sample
+		 * @return Minimum value
+		 */
+		auto get_min() const noexcept -> val_t { return m_min; }
+
+		/**
+		 * @brief Get maximum sample
+		 * @return Maximum value
+		 */
+		auto get_max() const noexcept -> val_t { return m_max; }
+
+		/**
+		 * @brief Get sum of all samples
+		 * @return Sum of samples
+		 */
+		auto get_sum() const noexcept -> val_t { return m_sum; }
+
+		/**
+		 * @brief Get sample count
+		 * @return Current number of samples
+		 */
+		auto get_smp_cnt() const noexcept -> std::size_t { return m_count; }
+
+		/**
+		 * @brief Clear accumulated moments
+		 */
+		auto clear_smps() noexcept -> void
+		{
+			m_count = 0;
+			m_mean	= 0.0;
+			m_m2	= 0.0;
+			m_sum	= val_t(0);
+			m_min	= val_t(0);
+			m_max	= val_t(0);
+		}
+
+		/**
+		 * @brief Reset averager
+		 */
+		auto reset() noexcept -> void { clear_smps(); }
+
+		/**
+		 * @brief Get standard deviation of samples
+		 * @return Expected containing std deviation or error
+		 */
+		auto get_std_dev() const noexcept -> utils::expected<val_t, std::string>
+		{
+			if (m_count < 2)
+			{
+				return val_t(0);
+			}
+
+			using std::sqrt;
+			return val_t(sqrt(m_m2 / static_cast<double>(m_count)));
+		}
+
+		/**
+		 * @brief Get variance of samples
+		 * @return Expected containing variance or error
+		 */
+		auto get_variance() const noexcept -> utils::expected<val_t, std::string>
+		{
+			if (m_count < 2)
+			{
+				return val_t(0);
+			}
+
+			return val_t(m_m2 / static_cast<double>(m_count));
+		}
+
+		/**
+		 * @brief Check if averager is empty
+		 * @return True if no samples
+		 */
+		auto empty() const noexcept -> bool { return m_count == 0; }
+	};
+
+	namespace detail
+	{
+		/**
+		 * @brief Single-quantile P-squared (Jain/Chlamtac) marker set
+		 *
+		 * Tracks one quantile with five markers; every insert adjusts marker
+		 * heights with parabolic interpolation, so memory and insert cost stay
+		 * constant regardless of stream length.
+		 */
+		class p2_accumulator
+		{
+		public:
+			using self_t = p2_accumulator;
+
+		private:
+			// Member variables
+			double m_quantile;
+			double m_heights[5];
+			double m_positions[5];
+			double m_desired[5];
+			double m_increments[5];
+			std::size_t m_count;
+
+		public:
+			explicit p2_accumulator(double p_quantile) noexcept : m_quantile(p_quantile), m_count(0)
+			{
+				for (std::size_t idx_for = 0; idx_for < 5; ++idx_for)
+				{
+					m_heights[idx_for]	 = 0.0;
+					m_positions[idx_for] = static_cast<double>(idx_for + 1);
+				}
+
+				m_desired[0] = 1.0;
+				m_desired[1] = 1.0 + (2.0 * p_quantile);
+				m_desired[2] = 1.0 + (4.0 * p_quantile);
+				m_desired[3] = 3.0 + (2.0 * p_quantile);
+				m_desired[4] = 5.0;
+
+				m_increments[0] = 0.0;
+				m_increments[1] = p_quantile / 2.0;
+				m_increments[2] = p_quantile;
+				m_increments[3] = (1.0 + p_quantile) / 2.0;
+				m_increments[4] = 1.0;
+			}
+
+		public:
+			auto quantile() const noexcept -> double { return m_quantile; }
+
+			auto add(double p_value) noexcept -> void
+			{
+				if (m_count < 5)
+				{
+					m_heights[m_count] = p_value;
+					++m_count;
+					if (m_count == 5)
+					{
+						sort_heights();
+					}
+					return;
+				}
+
+				std::size_t cell = 0;
+				if (p_value < m_heights[0])
+				{
+					m_heights[0] = p_value;
+					cell		 = 0;
+				}
+				else if (p_value >= m_heights[4])
+				{
+					m_heights[4] = p_value;
+					cell		 = 3;
+				}
+				else
+				{
+					while (cell < 3 && p_value >= m_heights[cell + 1])
+					{
+						++cell;
+					}
+				}
+
+				for (std::size_t idx_for = cell + 1; idx_for < 5; ++idx_for)
+				{
+					m_positions[idx_for] += 1.0;
+				}
+				for (std::size_t idx_for = 0; idx_for < 5; ++idx_for)
+				{
+					m_desired[idx_for] += m_increments[idx_for];
+				}
+
+				for (std::size_t marker = 1; marker < 4; ++marker)
+				{
+					const double offset = m_desired[marker] - m_positions[marker];
+					const double ahead	= m_positions[marker + 1] - m_positions[marker];
+					const double behind = m_positions[marker - 1] - m_positions[marker];
+					if ((offset >= 1.0 && ahead > 1.0) || (offset <= -1.0 && behind < -1.0))
+					{
+						const double step	 = (offset >= 0.0) ? 1.0 : -1.0;
+						const double shifted = parabolic(marker, step);
+						if (m_heights[marker - 1] < shifted && shifted < m_heights[marker + 1])
+						{
+							m_heights[marker] = shifted;
+						}
+						else
+						{
+							m_heights[marker] = linear(marker, step);
+						}
+						m_positions[marker] += step;
+					}
+				}
+
+				++m_count;
+			}
+
+			auto value() const noexcept -> double
+			{
+				if (m_count == 0)
+				{
+					return 0.0;
+				}
+
+				if (m_count < 5)
+				{
+					// Too few samples for markers: take the nearest rank directly
+					double sorted[5];
+					for (std::size_t idx_for = 0; idx_for < m_count; ++idx_for)
+					{
+						sorted[idx_for] = m_heights[idx_for];
+					}
+					std::sort(sorted, sorted + m_count);
+					const double rank = m_quantile * static_cast<double>(m_count - 1);
+					std::size_t lower = static_cast<std::size_t>(rank);
+					if (lower >= m_count - 1)
+					{
+						return sorted[m_count - 1];
+					}
+					const double frac = rank - static_cast<double>(lower);
+					return sorted[lower] + (frac * (sorted[lower + 1] - sorted[lower]));
+				}
+
+				return m_heights[2];
+			}
+
+			auto count() const noexcept -> std::size_t { return m_count; }
+
+			auto reset() noexcept -> void
+			{
+				*this = p2_accumulator(m_quantile);
+			}
+
+		private:
+			auto sort_heights() noexcept -> void { std::sort(m_heights, m_heights + 5); }
+
+			auto parabolic(std::size_t p_marker, double p_step) const noexcept -> double
+			{
+				const double pos_prev = m_positions[p_marker - 1];
+				const double pos_cur  = m_positions[p_marker];
+				const double pos_next = m_positions[p_marker + 1];
+				const double term_a	  = (pos_cur - pos_prev + p_step) * (m_heights[p_marker + 1] - m_heights[p_marker]) / (pos_next - pos_cur);
+				const double term_b	  = (pos_next - pos_cur - p_step) * (m_heights[p_marker] - m_heights[p_marker - 1]) / (pos_cur - pos_prev);
+				return m_heights[p_marker] + ((p_step / (pos_next - pos_prev)) * (term_a + term_b));
+			}
+
+			auto linear(std::size_t p_marker, double p_step) const noexcept -> double
+			{
+				const std::size_t neighbor = (p_step > 0.0) ? p_marker + 1 : p_marker - 1;
+				return m_heights[p_marker]
+					 + (p_step * (m_heights[neighbor] - m_heights[p_marker]) / (m_positions[neighbor] - m_positions[p_marker]));
+			}
+		};
+	}	 // namespace detail
+
+	/**
+	 * @brief Streaming quantile estimator using the P-squared algorithm
+	 *
+	 * Sibling to averager for percentile readouts: each tracked quantile keeps
+	 * five markers, so memory is bounded by the quantile set and inserts are
+	 * O(1). Defaults to p50/p95/p99/p999; estimates converge as samples arrive
+	 * and are exact while fewer than five samples have been seen.
+	 *
+	 * @tparam value_t Type of sample values
+	 */
+	template <typename value_t> class quantile_estimator
+	{
+	public:
+		// Type aliases
+		using self_t	 = quantile_estimator;
+		using val_t		 = value_t;
+		using val_cref_t = const value_t&;
+		using size_t	 = std::size_t;
+
+	private:
+		// Member variables
+		std::vector<detail::p2_accumulator> m_trackers;
+		std::size_t m_count = 0;
+
+	public:
+		/**
+		 * @brief Default constructor tracking p50, p95, p99 and p999
+		 */
+		quantile_estimator() : quantile_estimator(std::vector<double>{0.5, 0.95, 0.99, 0.999}) {}
+
+		/**
+		 * @brief Constructor with explicit quantile set
+		 * @param p_quantiles Quantiles to track, each in (0, 1)
+		 */
+		explicit quantile_estimator(const std::vector<double>& p_quantiles)
+		{
+			m_trackers.reserve(p_quantiles.size());
+			for (double quantile : p_quantiles)
+			{
+				m_trackers.emplace_back(quantile);
+			}
+		}
+
+	public:
+		/**
+		 * @brief Add sample value to every tracked quantile
+		 * @param p_sample Sample value to add
+		 */
+		auto add_sample(val_cref_t p_sample) noexcept -> void
+		{
+			const double value = static_cast<double>(p_sample);
+			for (detail::p2_accumulator& tracker : m_trackers)
+			{
+				tracker.add(value);
+			}
+			++m_count;
+		}
+
+		/**
+		 * @brief Get the estimate for a tracked quantile
+		 * @param p_quantile Quantile in (0, 1); must match a tracked quantile
+		 * @return Expected containing the estimate or error
+		 */
+		auto get_quantile(double p_quantile) const noexcept -> utils::expected<val_t, std::string>
+		{
+			if (m_count == 0)
+			{
+				return utils::make_unexpected(std::string("No samples"));
+			}
+
+			for (const detail::p2_accumulator& tracker : m_trackers)
+			{
+				if (std::fabs(tracker.quantile() - p_quantile) < 1e-9)
+				{
+					return val_t(tracker.value());
+				}
+			}
+
+			return utils::make_unexpected(std::string("Quantile not tracked"));
+		}
+
+		/**
+		 * @brief Get the median estimate
+		 * @return Expected containing p50 or error
+		 */
+		auto get_p50() const noexcept -> utils::expected<val_t, std::string> { return get_quantile(0.5); }
+
+		/**
+		 * @brief Get the 95th percentile estimate
+		 * @return Expected containing p95 or error
+		 */
+		auto get_p95() const noexcept -> utils::expected<val_t, std::string> { return get_quantile(0.95); }
+
+		/**
+		 * @brief Get the 99th percentile estimate
+		 * @return Expected containing p99 or error
+		 */
+		auto get_p99() const noexcept -> utils::expected<val_t, std::string> { return get_quantile(0.99); }
+
+		/**
+		 * @brief Get the 99.9th percentile estimate
+		 * @return Expected containing p999 or error
+		 */
+		auto get_p999() const noexcept -> utils::expected<val_t, std::string> { return get_quantile(0.999); }
+
+		/**
+		 * @brief Get sample count
+		 * @return Current number of samples
+		 */
+		auto get_smp_cnt() const noexcept -> std::size_t { return m_count; }
+
+		/**
+		 * @brief Check if estimator is empty
+		 * @return True if no samples
+		 */
+		auto empty() const noexcept -> bool { return m_count == 0; }
+
+		/**
+		 * @brief Reset estimator
+		 */
+		auto reset() noexcept -> void
+		{
+			for (detail::p2_accumulator& tracker : m_trackers)
+			{
+				tracker.reset();
+			}
+			m_count = 0;
+		}
+	};
+
 	/**
 	 * @brief Calculate proximity percentage of p_min relative to p_max.
 	 *
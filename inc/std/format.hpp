@@ -83,5 +83,220 @@ namespace std
 	#endif
 // IWYU pragma: end_exports
 
+	#include <cstddef>
+	#include <cstdio>
+	#include <cstring>
+	#include <iterator>
+	#include <string>
+	#include <type_traits>
+	#include <utility>
+
+// Fixed-buffer entry points: format into caller-owned storage with a hard
+// capacity and no heap allocation, plus a size precomputation that renders
+// into a counting sink. Available on every backend (fmt, std::format, or the
+// minimal fallback below) so hot paths can target stack and arena buffers
+// across all supported standards.
+namespace std
+{
+	namespace format_shim_detail
+	{
+		// Output iterator over a capped char buffer; counts every character it
+		// is handed but stores only the ones that fit, so the caller learns
+		// the untruncated size for free. A null buffer makes it a pure counter.
+		class bounded_char_iterator
+		{
+		public:
+			using iterator_category = std::output_iterator_tag;
+			using value_type		= void;
+			using difference_type	= std::ptrdiff_t;
+			using pointer			= void;
+			using reference			= void;
+
+			bounded_char_iterator(char* p_buffer, std::size_t p_capacity, std::size_t* p_written)
+				: m_buffer(p_buffer), m_capacity(p_capacity), m_written(p_written)
+			{
+			}
+
+			auto operator*() -> bounded_char_iterator& { return *this; }
+
+			auto operator++() -> bounded_char_iterator& { return *this; }
+
+			auto operator++(int) -> bounded_char_iterator& { return *this; }
+
+			auto operator=(char p_char) -> bounded_char_iterator&
+			{
+				if (m_buffer != nullptr && *m_written < m_capacity)
+				{
+					m_buffer[*m_written] = p_char;
+				}
+				++(*m_written);
+				return *this;
+			}
+
+		private:
+			char* m_buffer;
+			std::size_t m_capacity;
+			std::size_t* m_written;
+		};
+
+	#if !HAS_FMT_FORMAT && !HAS_STD_FORMAT
+		// Minimal fallback engine: supports {} placeholders and {{ }} escapes.
+		// Integers use a hand-rolled to_chars-style conversion and floats go
+		// through snprintf - no ostringstream anywhere on this path.
+		template <typename uint_t> inline auto emit_unsigned(bounded_char_iterator& p_out, uint_t p_value) -> void
+		{
+			char digits[24];
+			std::size_t count = 0;
+			do
+			{
+				digits[count++] = static_cast<char>('0' + (p_value % 10));
+				p_value /= 10;
+			} while (p_value > 0);
+
+			while (count > 0)
+			{
+				p_out = digits[--count];
+			}
+		}
+
+		inline auto emit_arg(bounded_char_iterator& p_out, bool p_value) -> void
+		{
+			const char* text = p_value ? "true" : "false";
+			for (const char* ch = text; *ch != '\0'; ++ch)
+			{
+				p_out = *ch;
+			}
+		}
+
+		inline auto emit_arg(bounded_char_iterator& p_out, char p_value) -> void { p_out = p_value; }
+
+		inline auto emit_arg(bounded_char_iterator& p_out, const char* p_value) -> void
+		{
+			for (const char* ch = (p_value != nullptr) ? p_value : "(null)"; *ch != '\0'; ++ch)
+			{
+				p_out = *ch;
+			}
+		}
+
+		inline auto emit_arg(bounded_char_iterator& p_out, const std::string& p_value) -> void
+		{
+			for (std::size_t idx_for = 0; idx_for < p_value.length(); ++idx_for)
+			{
+				p_out = p_value[idx_for];
+			}
+		}
+
+		template <typename int_t>
+		inline auto emit_arg(bounded_char_iterator& p_out,
+							 int_t p_value,
+							 typename std::enable_if<std::is_integral<int_t>::value && std::is_signed<int_t>::value>::type* = nullptr) -> void
+		{
+			using uint_t	= typename std::make_unsigned<int_t>::type;
+			uint_t absolute = static_cast<uint_t>(p_value);
+			if (p_value < 0)
+			{
+				p_out	 = '-';
+				absolute = static_cast<uint_t>(0) - absolute;
+			}
+			emit_unsigned(p_out, absolute);
+		}
+
+		template <typename int_t>
+		inline auto emit_arg(bounded_char_iterator& p_out,
+							 int_t p_value,
+							 typename std::enable_if<std::is_integral<int_t>::value && std::is_unsigned<int_t>::value>::type* = nullptr) -> void
+		{
+			emit_unsigned(p_out, p_value);
+		}
+
+		template <typename float_t>
+		inline auto emit_arg(bounded_char_iterator& p_out, float_t p_value, typename std::enable_if<std::is_floating_point<float_t>::value>::type* = nullptr)
+			-> void
+		{
+			char text[64];
+			const int length = std::snprintf(text, sizeof(text), "%g", static_cast<double>(p_value));
+			for (int idx_for = 0; idx_for < length; ++idx_for)
+			{
+				p_out = text[idx_for];
+			}
+		}
+
+		// Copies the remaining format text once the arguments are exhausted
+		inline auto render(bounded_char_iterator& p_out, const char* p_fmt) -> void
+		{
+			for (const char* ch = p_fmt; *ch != '\0'; ++ch)
+			{
+				if ((ch[0] == '{' && ch[1] == '{') || (ch[0] == '}' && ch[1] == '}'))
+				{
+					p_out = ch[0];
+					++ch;
+					continue;
+				}
+				p_out = *ch;
+			}
+		}
+
+		template <typename head_t, typename... tail_t>
+		inline auto render(bounded_char_iterator& p_out, const char* p_fmt, const head_t& p_head, const tail_t&... p_tail) -> void
+		{
+			for (const char* ch = p_fmt; *ch != '\0'; ++ch)
+			{
+				if ((ch[0] == '{' && ch[1] == '{') || (ch[0] == '}' && ch[1] == '}'))
+				{
+					p_out = ch[0];
+					++ch;
+					continue;
+				}
+				if (ch[0] == '{' && ch[1] == '}')
+				{
+					emit_arg(p_out, p_head);
+					render(p_out, ch + 2, p_tail...);
+					return;
+				}
+				p_out = *ch;
+			}
+		}
+	#endif
+
+		template <typename... args_t> inline auto render_to(bounded_char_iterator p_out, const char* p_fmt, args_t&&... p_args) -> void
+		{
+	#if HAS_FMT_FORMAT
+			fmt::vformat_to(p_out, fmt::string_view(p_fmt), fmt::make_format_args(p_args...));
+	#elif HAS_STD_FORMAT
+			std::vformat_to(p_out, std::string_view(p_fmt), std::make_format_args(p_args...));
+	#else
+			render(p_out, p_fmt, p_args...);
+	#endif
+		}
+	}	 // namespace format_shim_detail
+
+	// Formats into p_buffer, writing at most p_capacity bytes including the
+	// NUL terminator; returns the number of characters stored (excluding the
+	// terminator). Output beyond the capacity is counted but discarded.
+	template <typename... args_t> inline auto format_to(char* p_buffer, std::size_t p_capacity, const char* p_fmt, args_t&&... p_args) -> std::size_t
+	{
+		if (p_buffer == nullptr || p_capacity == 0)
+		{
+			return 0;
+		}
+
+		std::size_t written = 0;
+		format_shim_detail::render_to(format_shim_detail::bounded_char_iterator(p_buffer, p_capacity - 1, &written), p_fmt, std::forward<args_t>(p_args)...);
+
+		const std::size_t stored = (written < p_capacity - 1) ? written : p_capacity - 1;
+		p_buffer[stored]		 = '\0';
+		return stored;
+	}
+
+	// Renders into a counting sink without storing anything; returns the exact
+	// buffer size the formatted output needs (excluding a NUL terminator)
+	template <typename... args_t> inline auto formatted_size(const char* p_fmt, args_t&&... p_args) -> std::size_t
+	{
+		std::size_t written = 0;
+		format_shim_detail::render_to(format_shim_detail::bounded_char_iterator(nullptr, 0, &written), p_fmt, std::forward<args_t>(p_args)...);
+		return written;
+	}
+}	 // namespace std
+
 	#define HAS_PRINT_SUPPORT (HAS_STD_PRINT || HAS_FMT_FORMAT)
 #endif	  // FORMAT_HPP
\ No newline at end of file
@@ -420,6 +420,15 @@ namespace std
 		template <typename type_t, typename... args_t> friend auto get_if(variant<args_t...>* p_v) noexcept -> type_t*;
 
 		template <typename type_t, typename... args_t> friend auto get_if(const variant<args_t...>* p_v) noexcept -> const type_t*;
+
+		template <std::size_t idx_t, typename... args_t>
+		friend auto get_unchecked(variant<args_t...>& p_v) noexcept -> typename detail::at_index<idx_t, args_t...>::type&;
+
+		template <std::size_t idx_t, typename... args_t>
+		friend auto get_unchecked(const variant<args_t...>& p_v) noexcept -> const typename detail::at_index<idx_t, args_t...>::type&;
+
+		template <std::size_t idx_t, typename... args_t>
+		friend auto get_unchecked(variant<args_t...>&& p_v) noexcept -> typename detail::at_index<idx_t, args_t...>::type&&;
 	};
 
 	// Get by index
@@ -517,6 +526,45 @@ namespace std
 		return get_if<index>(p_v);
 	}
 
+	// Get unchecked by index - get_if-style fast path without the index
+	// branch; behavior is undefined if the variant does not hold the
+	// alternative at index_t
+	template <std::size_t index_t, typename... types_t> auto get_unchecked(variant<types_t...>& p_v) noexcept -> typename detail::at_index<index_t, types_t...>::type&
+	{
+		static_assert(index_t < sizeof...(types_t), "index out of bounds");
+		using type_t = typename detail::at_index<index_t, types_t...>::type;
+		return *reinterpret_cast<type_t*>(&p_v.m_storage);
+	}
+
+	template <std::size_t index_t, typename... types_t>
+	auto get_unchecked(const variant<types_t...>& p_v) noexcept -> const typename detail::at_index<index_t, types_t...>::type&
+	{
+		static_assert(index_t < sizeof...(types_t), "index out of bounds");
+		using type_t = typename detail::at_index<index_t, types_t...>::type;
+		return *reinterpret_cast<const type_t*>(&p_v.m_storage);
+	}
+
+	template <std::size_t index_t, typename... types_t>
+	auto get_unchecked(variant<types_t...>&& p_v) noexcept -> typename detail::at_index<index_t, types_t...>::type&&
+	{
+		static_assert(index_t < sizeof...(types_t), "index out of bounds");
+		using type_t = typename detail::at_index<index_t, types_t...>::type;
+		return std::move(*reinterpret_cast<type_t*>(&p_v.m_storage));
+	}
+
+	// Get unchecked by type
+	template <typename type_t, typename... types_t> auto get_unchecked(variant<types_t...>& p_v) noexcept -> type_t&
+	{
+		static_assert(detail::contains<type_t, types_t...>::value, "type not in variant");
+		return get_unchecked<detail::index_of<type_t, types_t...>::value>(p_v);
+	}
+
+	template <typename type_t, typename... types_t> auto get_unchecked(const variant<types_t...>& p_v) noexcept -> const type_t&
+	{
+		static_assert(detail::contains<type_t, types_t...>::value, "type not in variant");
+		return get_unchecked<detail::index_of<type_t, types_t...>::value>(p_v);
+	}
+
 	// Holds alternative
 	template <typename type_t, typename... types_t> auto holds_alternative(const variant<types_t...>& p_v) noexcept -> bool
 	{
@@ -574,7 +622,9 @@ namespace std
 		{
 			template <std::size_t idx_t> static auto invoke(visitor_t&& p_visitor, variant_t&& p_variant) -> return_t
 			{
-				return std::forward<visitor_t>(p_visitor)(get<idx_t>(std::forward<variant_t>(p_variant)));
+				// The table index already proved which alternative is active,
+				// so the unchecked accessor skips the redundant branch
+				return std::forward<visitor_t>(p_visitor)(get_unchecked<idx_t>(std::forward<variant_t>(p_variant)));
 			}
 
 			template <std::size_t... indices_t>
@@ -590,35 +640,36 @@ namespace std
 			}
 		};
 
-		template <typename visitor_t, typename variant_t> struct visit_impl
+		// Maps the (possibly cv/ref-qualified) variant type onto its alternative
+		// pack so visit can build one static table per instantiation
+		template <typename visitor_t, typename variant_t, typename return_t, typename decayed_t> struct visit_table;
+
+		template <typename visitor_t, typename variant_t, typename return_t, typename... variant_types_t>
+		struct visit_table<visitor_t, variant_t, return_t, variant<variant_types_t...> >
 		{
-			template <std::size_t index_t = 0>
-			static auto apply(visitor_t&& p_visitor, variant_t&& p_variant) ->
-				typename std::enable_if<index_t >= variant_size<typename std::decay<variant_t>::type>::value,
-										decltype(p_visitor(get<0>(std::forward<variant_t>(p_variant))))>::type
+			static auto get() -> const std::array<return_t (*)(visitor_t&&, variant_t&&), sizeof...(variant_types_t)>&
 			{
-				MACRO_THROW(bad_variant_access("variant in invalid state"));
-			}
-
-			template <std::size_t index_t = 0>
-				static auto apply(visitor_t&& p_visitor, variant_t&& p_variant) -> typename std::enable_if
-				< index_t<variant_size<typename std::decay<variant_t>::type>::value,
-						  decltype(p_visitor(get<0>(std::forward<variant_t>(p_variant))))>::type
-			{
-				if (p_variant.index() == index_t)
-				{
-					return p_visitor(get<index_t>(std::forward<variant_t>(p_variant)));
-				}
-				return apply<index_t + 1>(std::forward<visitor_t>(p_visitor), std::forward<variant_t>(p_variant));
+				static const auto table = visit_invoker<visitor_t, variant_t, return_t, variant_types_t...>::make_table();
+				return table;
 			}
 		};
 	}	 // namespace detail
 
-	// Visit function
+	// Visit function - O(1) dispatch through a function-pointer table indexed
+	// by the active alternative, instead of a recursive if-chain
 	template <typename visitor_t, typename variant_t>
 	auto visit(visitor_t&& p_visitor, variant_t&& p_variant) -> decltype(p_visitor(get<0>(std::forward<variant_t>(p_variant))))
 	{
-		return detail::visit_impl<visitor_t, variant_t>::template apply<0>(std::forward<visitor_t>(p_visitor), std::forward<variant_t>(p_variant));
+		using return_t	= decltype(p_visitor(get<0>(std::forward<variant_t>(p_variant))));
+		using decayed_t = typename std::decay<variant_t>::type;
+
+		if (p_variant.index() == variant_npos)
+		{
+			MACRO_THROW(bad_variant_access("variant in invalid state"));
+		}
+
+		return detail::visit_table<visitor_t, variant_t, return_t, decayed_t>::get()[p_variant.index()](std::forward<visitor_t>(p_visitor),
+																									   std::forward<variant_t>(p_variant));
 	}
 
 	// Swap
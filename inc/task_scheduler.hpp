@@ -0,0 +1,600 @@
+#pragma once
+#ifndef TASK_SCHEDULER_HPP
+	#define TASK_SCHEDULER_HPP
+
+	#include <atomic>
+	#include <cassert>
+	#include <chrono>
+	#include <condition_variable>
+	#include <cstddef>
+	#include <cstdint>
+	#include <deque>
+	#include <exception>
+	#include <functional>
+	#include <memory>
+	#include <mutex>
+	#include <thread>
+	#include <utility>
+	#include <vector>
+
+namespace utils
+{
+	/**
+	 * @brief Shared work-stealing thread pool
+	 *
+	 * One pool per process (via instance()) that every parallel subsystem
+	 * submits to, instead of each spinning up its own threads. Each worker
+	 * owns a Chase-Lev deque: the owner pushes and pops at the bottom
+	 * without locks, idle workers steal from the top with a CAS. Tasks
+	 * submitted from outside the pool land on a mutex-protected overflow
+	 * queue that workers drain between deque runs; tasks spawned from
+	 * inside a worker go straight onto that worker's own deque, so
+	 * fork-join parallelism stays on the fast path.
+	 *
+	 * Worker threads start lazily on the first submission and are sized to
+	 * the hardware concurrency. parallel_for() batches its chunk tasks into
+	 * a single enqueue-and-wake, and waiting on a task_group from a worker
+	 * thread helps execute outstanding tasks rather than blocking, so
+	 * nested parallel calls cannot deadlock the pool.
+	 */
+	class task_scheduler
+	{
+	public:
+		using self_t	= task_scheduler;
+		using task_fn_t = std::function<void()>;
+
+		class task_group;
+
+	private:
+		// One scheduled unit: the callable plus the group awaiting it
+		struct task_node
+		{
+			task_fn_t m_fn;
+			task_group* m_group;
+
+			task_node(task_fn_t p_fn, task_group* p_group) : m_fn(std::move(p_fn)), m_group(p_group) {}
+		};
+
+		// Chase-Lev deque of task_node pointers. Only the owning worker
+		// calls push/pop; any thread may call steal. Orderings follow the
+		// published algorithm, with seq_cst on the bottom/top handoff pair
+		// instead of standalone fences.
+		class work_deque
+		{
+		private:
+			struct ring
+			{
+				std::int64_t m_mask;
+				std::unique_ptr<std::atomic<task_node*>[]> m_slots;
+
+				explicit ring(std::int64_t p_capacity) : m_mask(p_capacity - 1), m_slots(new std::atomic<task_node*>[p_capacity]) {}
+			};
+
+			std::atomic<std::int64_t> m_top;
+			std::atomic<std::int64_t> m_bottom;
+			std::atomic<ring*> m_ring;
+			std::vector<std::unique_ptr<ring> > m_rings;	// owner-only; keeps retired rings alive for in-flight steals
+
+		public:
+			work_deque() : m_top(0), m_bottom(0)
+			{
+				m_rings.emplace_back(new ring(256));
+				m_ring.store(m_rings.back().get(), std::memory_order_relaxed);
+			}
+
+			work_deque(const work_deque&)					 = delete;
+			auto operator=(const work_deque&) -> work_deque& = delete;
+
+			// Owner only
+			auto push(task_node* p_node) -> void
+			{
+				const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+				const std::int64_t top	  = m_top.load(std::memory_order_acquire);
+				ring* current			  = m_ring.load(std::memory_order_relaxed);
+
+				if (bottom - top > current->m_mask)
+				{
+					current = grow(current, top, bottom);
+				}
+
+				current->m_slots[bottom & current->m_mask].store(p_node, std::memory_order_relaxed);
+				m_bottom.store(bottom + 1, std::memory_order_seq_cst);
+			}
+
+			// Owner only
+			auto pop() -> task_node*
+			{
+				const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+				ring* current			  = m_ring.load(std::memory_order_relaxed);
+				m_bottom.store(bottom, std::memory_order_seq_cst);
+
+				std::int64_t top = m_top.load(std::memory_order_seq_cst);
+				task_node* node	 = nullptr;
+
+				if (top <= bottom)
+				{
+					node = current->m_slots[bottom & current->m_mask].load(std::memory_order_relaxed);
+					if (top == bottom)
+					{
+						// Last element: race the stealers for it
+						if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						{
+							node = nullptr;
+						}
+						m_bottom.store(bottom + 1, std::memory_order_relaxed);
+					}
+				}
+				else
+				{
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				}
+				return node;
+			}
+
+			// Any thread; returns nullptr on empty or lost race
+			auto steal() -> task_node*
+			{
+				std::int64_t top		  = m_top.load(std::memory_order_seq_cst);
+				const std::int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+
+				if (top >= bottom)
+				{
+					return nullptr;
+				}
+
+				ring* current	= m_ring.load(std::memory_order_acquire);
+				task_node* node = current->m_slots[top & current->m_mask].load(std::memory_order_relaxed);
+				if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					return nullptr;
+				}
+				return node;
+			}
+
+		private:
+			auto grow(ring* p_old, std::int64_t p_top, std::int64_t p_bottom) -> ring*
+			{
+				ring* bigger = new ring((p_old->m_mask + 1) * 2);
+				for (std::int64_t idx_for = p_top; idx_for < p_bottom; ++idx_for)
+				{
+					bigger->m_slots[idx_for & bigger->m_mask].store(p_old->m_slots[idx_for & p_old->m_mask].load(std::memory_order_relaxed),
+																	std::memory_order_relaxed);
+				}
+				m_rings.emplace_back(bigger);
+				m_ring.store(bigger, std::memory_order_release);
+				return bigger;
+			}
+		};
+
+		struct worker
+		{
+			work_deque m_deque;
+			std::thread m_thread;
+		};
+
+	public:
+		/**
+		 * @brief Fork-join handle: counts outstanding tasks, propagates the
+		 * first exception, and helps execute work while waiting on a worker
+		 */
+		class task_group
+		{
+		private:
+			task_scheduler* m_scheduler;
+			std::atomic<std::size_t> m_pending;
+			std::mutex m_mutex;
+			std::condition_variable m_cv;
+			std::exception_ptr m_error;
+
+			friend class task_scheduler;
+
+		public:
+			explicit task_group(task_scheduler& p_scheduler = task_scheduler::instance()) : m_scheduler(&p_scheduler), m_pending(0), m_error(nullptr) {}
+
+			task_group(const task_group&)					 = delete;
+			auto operator=(const task_group&) -> task_group& = delete;
+
+			template <typename func_t> auto run(func_t p_func) -> void
+			{
+				m_pending.fetch_add(1, std::memory_order_relaxed);
+				m_scheduler->enqueue(new task_node(task_fn_t(std::move(p_func)), this));
+			}
+
+			auto wait() -> void
+			{
+				m_scheduler->wait_for_group(*this);
+				if (m_error)
+				{
+					std::rethrow_exception(m_error);
+				}
+			}
+
+		private:
+			auto record_error(std::exception_ptr p_error) -> void
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (!m_error)
+				{
+					m_error = p_error;
+				}
+			}
+
+			auto finish_one() -> void
+			{
+				// Decrement and notify under the mutex: a waiter may destroy
+				// this group the moment it observes pending == 0, so nothing
+				// here may touch members after the count drops outside the lock
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					m_cv.notify_all();
+				}
+			}
+		};
+
+	private:
+		std::vector<std::unique_ptr<worker> > m_workers;
+		std::deque<task_node*> m_overflow;	  // external submissions and batch drops
+		std::mutex m_mutex;					  // guards m_overflow and sleep/wake
+		std::condition_variable m_wake_cv;
+		std::once_flag m_start_flag;
+		std::atomic<bool> m_started;
+		std::atomic<bool> m_stop;
+		std::size_t m_worker_count;
+
+		// Which worker (if any) the current thread is; set once per worker thread
+		struct tls_binding
+		{
+			task_scheduler* m_scheduler;
+			std::size_t m_index;
+		};
+
+		static auto current_binding() -> tls_binding&
+		{
+			static thread_local tls_binding binding = {nullptr, 0};
+			return binding;
+		}
+
+	public:
+		~task_scheduler()
+		{
+			if (m_started.load(std::memory_order_acquire))
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_stop.store(true, std::memory_order_release);
+				}
+				m_wake_cv.notify_all();
+				for (auto& entry : m_workers)
+				{
+					if (entry->m_thread.joinable())
+					{
+						entry->m_thread.join();
+					}
+				}
+			}
+			drain_abandoned();
+		}
+
+		explicit task_scheduler(std::size_t p_worker_count = 0) : m_started(false), m_stop(false), m_worker_count(p_worker_count)
+		{
+			if (m_worker_count == 0)
+			{
+				m_worker_count = std::thread::hardware_concurrency();
+				if (m_worker_count == 0)
+				{
+					m_worker_count = 2;
+				}
+			}
+		}
+
+		task_scheduler(const self_t&)				 = delete;
+		auto operator=(const self_t&) -> self_t&	 = delete;
+		task_scheduler(self_t&&)					 = delete;
+		auto operator=(self_t&&) -> self_t&			 = delete;
+
+		// Process-wide shared pool; created on first use, lives until exit
+		static auto instance() -> self_t&
+		{
+			static self_t scheduler;
+			return scheduler;
+		}
+
+		auto worker_count() const -> std::size_t { return m_worker_count; }
+
+		// Fire-and-forget submission
+		template <typename func_t> auto submit(func_t p_func) -> void { enqueue(new task_node(task_fn_t(std::move(p_func)), nullptr)); }
+
+		/**
+		 * @brief Runs p_func(chunk_first, chunk_last) over [p_first, p_last)
+		 * in parallel chunks of at most p_grain indices
+		 *
+		 * p_grain of zero picks a grain that yields a few chunks per worker.
+		 * All chunk tasks are enqueued as one batch with a single wake, and
+		 * the calling thread participates in executing them.
+		 */
+		template <typename func_t> auto parallel_for(std::size_t p_first, std::size_t p_last, std::size_t p_grain, func_t p_func) -> void
+		{
+			if (p_first >= p_last)
+			{
+				return;
+			}
+
+			const std::size_t count = p_last - p_first;
+			std::size_t grain		= p_grain;
+			if (grain == 0)
+			{
+				grain = count / (m_worker_count * 4);
+				if (grain == 0)
+				{
+					grain = 1;
+				}
+			}
+
+			if (count <= grain || m_worker_count < 2)
+			{
+				p_func(p_first, p_last);
+				return;
+			}
+
+			ensure_started();
+			task_group group(*this);
+
+			// The first chunk runs on the calling thread; the rest go out
+			// as one batch so the pool is woken once
+			std::vector<task_node*> batch;
+			batch.reserve((count - 1) / grain);
+			for (std::size_t offset = p_first + grain; offset < p_last; offset += grain)
+			{
+				const std::size_t chunk_last = (offset + grain < p_last) ? offset + grain : p_last;
+				group.m_pending.fetch_add(1, std::memory_order_relaxed);
+				batch.push_back(new task_node(task_fn_t([offset, chunk_last, p_func]() { p_func(offset, chunk_last); }), &group));
+			}
+			enqueue_batch(batch);
+
+			// The inline chunk must not let an exception past wait(): worker
+			// tasks still hold pointers to the group. Record it like a worker
+			// chunk would and let wait() rethrow the first error
+			try
+			{
+				p_func(p_first, p_first + grain);
+			}
+			catch (...)
+			{
+				group.record_error(std::current_exception());
+			}
+			group.wait();
+		}
+
+		/**
+		 * @brief Element-wise parallel_for over a random-access range
+		 */
+		template <typename range_t, typename func_t> auto parallel_for_each(range_t&& p_range, std::size_t p_grain, func_t p_func) -> void
+		{
+			auto first = std::begin(p_range);
+			using diff_t = decltype(std::end(p_range) - first);
+			const std::size_t count = static_cast<std::size_t>(std::end(p_range) - first);
+			parallel_for(0, count, p_grain,
+						 [first, p_func](std::size_t p_chunk_first, std::size_t p_chunk_last)
+						 {
+							 for (std::size_t idx_for = p_chunk_first; idx_for < p_chunk_last; ++idx_for)
+							 {
+								 p_func(first[static_cast<diff_t>(idx_for)]);
+							 }
+						 });
+		}
+
+	private:
+		auto ensure_started() -> void
+		{
+			std::call_once(m_start_flag,
+						   [this]()
+						   {
+							   m_workers.reserve(m_worker_count);
+							   for (std::size_t idx_for = 0; idx_for < m_worker_count; ++idx_for)
+							   {
+								   m_workers.emplace_back(new worker());
+							   }
+							   // Deques exist before any thread runs, so stealing never
+							   // races worker registration
+							   for (std::size_t idx_for = 0; idx_for < m_worker_count; ++idx_for)
+							   {
+								   m_workers[idx_for]->m_thread = std::thread(&task_scheduler::worker_loop, this, idx_for);
+							   }
+							   m_started.store(true, std::memory_order_release);
+						   });
+		}
+
+		auto enqueue(task_node* p_node) -> void
+		{
+			ensure_started();
+			tls_binding& binding = current_binding();
+			if (binding.m_scheduler == this)
+			{
+				m_workers[binding.m_index]->m_deque.push(p_node);
+				m_wake_cv.notify_one();
+				return;
+			}
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_overflow.push_back(p_node);
+			}
+			m_wake_cv.notify_one();
+		}
+
+		auto enqueue_batch(std::vector<task_node*>& p_batch) -> void
+		{
+			if (p_batch.empty())
+			{
+				return;
+			}
+			tls_binding& binding = current_binding();
+			if (binding.m_scheduler == this)
+			{
+				for (task_node* node : p_batch)
+				{
+					m_workers[binding.m_index]->m_deque.push(node);
+				}
+			}
+			else
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				for (task_node* node : p_batch)
+				{
+					m_overflow.push_back(node);
+				}
+			}
+			m_wake_cv.notify_all();
+		}
+
+		auto take_overflow() -> task_node*
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_overflow.empty())
+			{
+				return nullptr;
+			}
+			task_node* node = m_overflow.front();
+			m_overflow.pop_front();
+			return node;
+		}
+
+		// Round-robin steal sweep starting after p_self (npos for external callers)
+		auto try_steal(std::size_t p_self) -> task_node*
+		{
+			const std::size_t count = m_workers.size();
+			for (std::size_t idx_for = 1; idx_for <= count; ++idx_for)
+			{
+				const std::size_t victim = (p_self + idx_for) % count;
+				if (victim == p_self)
+				{
+					continue;
+				}
+				task_node* node = m_workers[victim]->m_deque.steal();
+				if (node != nullptr)
+				{
+					return node;
+				}
+			}
+			return nullptr;
+		}
+
+		auto find_task(std::size_t p_self) -> task_node*
+		{
+			task_node* node = m_workers[p_self]->m_deque.pop();
+			if (node == nullptr)
+			{
+				node = take_overflow();
+			}
+			if (node == nullptr)
+			{
+				node = try_steal(p_self);
+			}
+			return node;
+		}
+
+		static auto execute(task_node* p_node) -> void
+		{
+			task_group* group = p_node->m_group;
+			try
+			{
+				p_node->m_fn();
+			}
+			catch (...)
+			{
+				if (group != nullptr)
+				{
+					group->record_error(std::current_exception());
+				}
+			}
+			delete p_node;
+			if (group != nullptr)
+			{
+				group->finish_one();
+			}
+		}
+
+		auto worker_loop(std::size_t p_index) -> void
+		{
+			tls_binding& binding = current_binding();
+			binding.m_scheduler	 = this;
+			binding.m_index		 = p_index;
+
+			for (;;)
+			{
+				task_node* node = find_task(p_index);
+				if (node != nullptr)
+				{
+					execute(node);
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(m_mutex);
+				if (m_stop.load(std::memory_order_acquire))
+				{
+					return;
+				}
+				if (!m_overflow.empty())
+				{
+					continue;
+				}
+				// Timed wait backstops a missed wake between the empty
+				// deque sweep and going to sleep
+				m_wake_cv.wait_for(lock, std::chrono::milliseconds(10));
+			}
+		}
+
+		auto wait_for_group(task_group& p_group) -> void
+		{
+			tls_binding& binding = current_binding();
+			if (binding.m_scheduler == this)
+			{
+				// On a worker: help drain the pool instead of blocking, so
+				// nested waits cannot starve it
+				while (p_group.m_pending.load(std::memory_order_acquire) != 0)
+				{
+					task_node* node = find_task(binding.m_index);
+					if (node != nullptr)
+					{
+						execute(node);
+					}
+					else
+					{
+						std::this_thread::yield();
+					}
+				}
+
+				// The last finisher decrements while holding m_mutex; taking
+				// it once here means finish_one has fully released the group
+				// before the caller can return and destroy it
+				{
+					std::lock_guard<std::mutex> lock(p_group.m_mutex);
+				}
+				return;
+			}
+
+			std::unique_lock<std::mutex> lock(p_group.m_mutex);
+			p_group.m_cv.wait(lock, [&p_group]() { return p_group.m_pending.load(std::memory_order_acquire) == 0; });
+		}
+
+		auto drain_abandoned() -> void
+		{
+			for (task_node* node : m_overflow)
+			{
+				delete node;
+			}
+			m_overflow.clear();
+			for (auto& entry : m_workers)
+			{
+				task_node* node = entry->m_deque.pop();
+				while (node != nullptr)
+				{
+					delete node;
+					node = entry->m_deque.pop();
+				}
+			}
+		}
+	};
+}	 // namespace utils
+
+#endif	  // TASK_SCHEDULER_HPP
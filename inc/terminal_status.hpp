@@ -32,7 +32,10 @@ namespace terminal
 
 	private:
 		utils::precision_timer<std::chrono::milliseconds> m_timer;
+		utils::precision_timer<std::chrono::milliseconds> m_frame_timer;
 		std::map<std::int32_t, std::string> m_lines;
+		std::map<std::int32_t, std::string> m_shadow_lines;
+		std::string m_frame_buffer;
 		std::int32_t m_requested_lines;
 		std::int32_t m_term_rows;
 		std::int32_t m_term_cols;
@@ -42,6 +45,12 @@ namespace terminal
 		struct sigaction m_old_sigwinch_handler;
 		bool m_signal_handler_set;
 		std::uint32_t m_last_elapsed_ms;
+		std::uint32_t m_frame_interval_ms;
+		std::uint32_t m_last_frame_ms;
+		bool m_frame_pending;
+		bool m_frame_drawn;
+
+		static constexpr std::uint32_t k_default_frame_interval_ms = 16;
 
 	public:
 		/**
@@ -67,7 +76,16 @@ namespace terminal
 		 * @brief Default constructor
 		 */
 		status_manager()
-			: m_requested_lines(0), m_term_rows(0), m_term_cols(0), m_initialized(false), m_signal_handler_set(false), m_last_elapsed_ms(0)
+			: m_requested_lines(0),
+			  m_term_rows(0),
+			  m_term_cols(0),
+			  m_initialized(false),
+			  m_signal_handler_set(false),
+			  m_last_elapsed_ms(0),
+			  m_frame_interval_ms(k_default_frame_interval_ms),
+			  m_last_frame_ms(0),
+			  m_frame_pending(false),
+			  m_frame_drawn(false)
 		{
 		}
 
@@ -79,13 +97,18 @@ namespace terminal
 		 */
 		status_manager(self_t&& p_other) noexcept
 			: m_lines(std::move(p_other.m_lines)),
+			  m_shadow_lines(std::move(p_other.m_shadow_lines)),
 			  m_requested_lines(p_other.m_requested_lines),
 			  m_term_rows(p_other.m_term_rows),
 			  m_term_cols(p_other.m_term_cols),
 			  m_initialized(p_other.m_initialized),
 			  m_old_sigwinch_handler(p_other.m_old_sigwinch_handler),
 			  m_signal_handler_set(p_other.m_signal_handler_set),
-			  m_last_elapsed_ms(p_other.m_last_elapsed_ms)
+			  m_last_elapsed_ms(p_other.m_last_elapsed_ms),
+			  m_frame_interval_ms(p_other.m_frame_interval_ms),
+			  m_last_frame_ms(p_other.m_last_frame_ms),
+			  m_frame_pending(p_other.m_frame_pending),
+			  m_frame_drawn(p_other.m_frame_drawn)
 		{
 			p_other.m_initialized		 = false;
 			p_other.m_signal_handler_set = false;
@@ -111,6 +134,7 @@ namespace terminal
 					restore_signal_handler();
 				}
 				m_lines						 = std::move(p_other.m_lines);
+				m_shadow_lines				 = std::move(p_other.m_shadow_lines);
 				m_requested_lines			 = p_other.m_requested_lines;
 				m_term_rows					 = p_other.m_term_rows;
 				m_term_cols					 = p_other.m_term_cols;
@@ -118,6 +142,10 @@ namespace terminal
 				m_old_sigwinch_handler		 = p_other.m_old_sigwinch_handler;
 				m_signal_handler_set		 = p_other.m_signal_handler_set;
 				m_last_elapsed_ms			 = p_other.m_last_elapsed_ms;
+				m_frame_interval_ms			 = p_other.m_frame_interval_ms;
+				m_last_frame_ms				 = p_other.m_last_frame_ms;
+				m_frame_pending				 = p_other.m_frame_pending;
+				m_frame_drawn				 = p_other.m_frame_drawn;
 				p_other.m_initialized		 = false;
 				p_other.m_signal_handler_set = false;
 				if (s_active_instance == &p_other)
@@ -189,11 +217,17 @@ namespace terminal
 		auto update_term_size() -> void
 		{
 			struct winsize ws;
-			if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == 0)
+			if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == 0 && ws.ws_row > 0 && ws.ws_col > 0)
 			{
 				m_term_rows = static_cast<std::int32_t>(ws.ws_row);
 				m_term_cols = static_cast<std::int32_t>(ws.ws_col);
 			}
+			else
+			{
+				// Not a tty (or bogus size reported): assume a classic 80x24
+				m_term_rows = 24;
+				m_term_cols = 80;
+			}
 		}
 
 		/**
@@ -227,6 +261,7 @@ namespace terminal
 			}
 
 			std::fflush(stdout);
+			m_shadow_lines.clear();
 			m_initialized = true;
 		}
 
@@ -254,11 +289,15 @@ namespace terminal
 
 			std::print("\033[u");	 // Restore cursor position
 			std::fflush(stdout);
+			m_shadow_lines.clear();
 			m_initialized = false;
 		}
 
 		/**
-		 * @brief Redraw all status lines
+		 * @brief Redraw status lines, honoring the frame-rate cap
+		 *
+		 * Within the frame interval the redraw is only marked pending; the next
+		 * redraw request (or process_events) past the interval emits it.
 		 */
 		auto redraw_lines() -> void
 		{
@@ -269,28 +308,96 @@ namespace terminal
 
 			check_resize();
 
-			std::print("\033[s");	 // Save cursor position
+			if (!m_frame_timer.is_started())
+			{
+				m_frame_timer.start();
+			}
+
+			const std::uint32_t now_ms = m_frame_timer.get_elapsed().count();
+			if (m_frame_drawn && m_frame_interval_ms > 0 && (now_ms - m_last_frame_ms) < m_frame_interval_ms)
+			{
+				m_frame_pending = true;
+				return;
+			}
+
+			m_last_frame_ms = now_ms;
+			render_frame();
+		}
+
+		/**
+		 * @brief Emit one frame, writing only the spans that changed
+		 *
+		 * Compares each line against the shadow copy of the last-drawn frame,
+		 * skips the common prefix (and suffix for equal-length lines) and
+		 * coalesces all damaged spans into a single buffered write.
+		 */
+		auto render_frame() -> void
+		{
+			m_frame_buffer.clear();
+			m_frame_buffer += "\033[s";	   // Save cursor position
 
+			bool damaged = false;
 			for (std::int32_t idx_for = 1; idx_for <= m_requested_lines; ++idx_for)
 			{
 				std::int32_t row = m_term_rows - m_requested_lines + idx_for;
-				std::print("\033[{};0H", row);	  // Move to line
-				std::print("\033[0K");			  // Clear line
 
+				std::string text;
 				auto it = m_lines.find(idx_for);
 				if (it != m_lines.end())
 				{
-					// Truncate if too long
-					std::string text = it->second;
+					text = it->second;
 					if (static_cast<std::int32_t>(text.length()) > m_term_cols)
 					{
 						text = text.substr(0, static_cast<std::size_t>(m_term_cols));
 					}
-					std::print("{}", text);
 				}
+
+				std::string& shadow = m_shadow_lines[idx_for];
+				if (text == shadow)
+				{
+					continue;
+				}
+
+				// Skip the unchanged prefix shared with the last frame
+				const std::size_t min_len = std::min(text.length(), shadow.length());
+				std::size_t start		  = 0;
+				while (start < min_len && text[start] == shadow[start])
+				{
+					++start;
+				}
+
+				// Equal-length lines can also drop the unchanged suffix
+				std::size_t end = text.length();
+				if (text.length() == shadow.length())
+				{
+					while (end > start && text[end - 1] == shadow[end - 1])
+					{
+						--end;
+					}
+				}
+
+				m_frame_buffer += std::format("\033[{};{}H", row, start + 1);	 // Move to damaged span
+				m_frame_buffer += text.substr(start, end - start);
+				if (text.length() < shadow.length())
+				{
+					m_frame_buffer += "\033[0K";	// Clear stale tail
+				}
+
+				shadow	= text;
+				damaged = true;
 			}
 
-			std::print("\033[u");	 // Restore cursor position
+			m_frame_buffer += "\033[u";	   // Restore cursor position
+
+			m_frame_pending = false;
+			m_frame_drawn	= true;
+
+			if (!damaged)
+			{
+				return;
+			}
+
+			std::fwrite(m_frame_buffer.data(), 1, m_frame_buffer.length(), stdout);
 			std::fflush(stdout);
 		}
 
@@ -366,7 +473,7 @@ namespace terminal
 			{
 				deinit();
 				init();
-				redraw_lines();
+				flush();
 			}
 		}
 
@@ -431,9 +538,44 @@ namespace terminal
 		}
 
 		/**
-		 * @brief Process pending resize events
+		 * @brief Set the maximum redraw rate in frames per second
+		 *
+		 * Zero disables the cap and every update is emitted immediately.
+		 */
+		auto set_max_frame_rate(std::uint32_t p_fps) -> void { m_frame_interval_ms = (p_fps > 0) ? (1000 / p_fps) : 0; }
+
+		/**
+		 * @brief Emit any pending frame immediately, ignoring the frame-rate cap
+		 */
+		auto flush() -> void
+		{
+			if (!m_initialized)
+			{
+				return;
+			}
+
+			check_resize();
+
+			if (!m_frame_timer.is_started())
+			{
+				m_frame_timer.start();
+			}
+
+			m_last_frame_ms = m_frame_timer.get_elapsed().count();
+			render_frame();
+		}
+
+		/**
+		 * @brief Process pending resize events and any rate-capped frame
 		 */
-		auto process_events() -> void { check_resize(); }
+		auto process_events() -> void
+		{
+			check_resize();
+			if (m_frame_pending)
+			{
+				redraw_lines();
+			}
+		}
 	};
 
 	// Static member definitions
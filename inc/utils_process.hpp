@@ -14,16 +14,31 @@
 	#include <map>
 	#include <memory>
 	#include <mutex>
+	#include <queue>
 	#include <string>
 	#include <thread>
 	#include <utility>
 	#include <vector>
 
+	#include "cmemory.hpp"
+
 	#include <fcntl.h>
+	#include <spawn.h>
+	#include <sys/epoll.h>
 	#include <sys/select.h>
+	#include <sys/uio.h>
 	#include <sys/wait.h>
 	#include <unistd.h>
 
+	#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+		#if __GLIBC_PREREQ(2, 29)
+			#define UTILS_PROCESS_HAS_SPAWN_CHDIR 1
+		#endif
+	#endif
+	#ifndef UTILS_PROCESS_HAS_SPAWN_CHDIR
+		#define UTILS_PROCESS_HAS_SPAWN_CHDIR 0
+	#endif
+
 // =============================================================================
 // CONSTANTS AND CONFIGURATION
 // =============================================================================
@@ -48,6 +63,7 @@ namespace utils
 		static const auto k_stdin_write_retry_ms	   = std::chrono::milliseconds(5);
 		static const std::int32_t k_max_idle_cycles	   = 50;	// Reduced for responsiveness
 		static const std::int32_t k_max_drain_attempts = 20;	// Increased thoroughness
+		static const std::int32_t k_epoll_max_events   = 4;		// stdout + stderr per child
 	}	 // namespace process_consts
 
 	// =============================================================================
@@ -191,6 +207,70 @@ namespace utils
 			}
 		};
 
+		// =============================================================================
+		// EPOLL REACTOR
+		// =============================================================================
+
+		class epoll_reactor
+		{
+		private:
+			std::int32_t m_epoll_fd{-1};
+
+		public:
+			epoll_reactor() : m_epoll_fd(epoll_create1(EPOLL_CLOEXEC)) {}
+
+			~epoll_reactor()
+			{
+				if (m_epoll_fd != -1)
+				{
+					close(m_epoll_fd);
+				}
+			}
+
+			epoll_reactor(const epoll_reactor&)					   = delete;
+			auto operator=(const epoll_reactor&) -> epoll_reactor& = delete;
+
+			epoll_reactor(epoll_reactor&& p_other) noexcept : m_epoll_fd(p_other.m_epoll_fd) { p_other.m_epoll_fd = -1; }
+
+			auto operator=(epoll_reactor&& p_other) noexcept -> epoll_reactor&
+			{
+				if (this != &p_other)
+				{
+					if (m_epoll_fd != -1)
+					{
+						close(m_epoll_fd);
+					}
+					m_epoll_fd		  = p_other.m_epoll_fd;
+					p_other.m_epoll_fd = -1;
+				}
+				return *this;
+			}
+
+			auto is_valid() const -> bool { return m_epoll_fd != -1; }
+
+			// Registers p_fd edge-triggered; the fd must be non-blocking so the
+			// handler can drain until EAGAIN.
+			auto add(std::int32_t p_fd) -> bool
+			{
+				struct epoll_event event = {};
+				event.events			 = EPOLLIN | EPOLLET;
+				event.data.fd			 = p_fd;
+				return epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, p_fd, &event) == 0;
+			}
+
+			auto remove(std::int32_t p_fd) -> void { epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, p_fd, nullptr); }
+
+			auto wait(struct epoll_event* p_events, std::int32_t p_max_events, std::int32_t p_timeout_ms) -> std::int32_t
+			{
+				const std::int32_t ready = epoll_wait(m_epoll_fd, p_events, p_max_events, p_timeout_ms);
+				if (ready == -1 && errno == EINTR)
+				{
+					return 0;
+				}
+				return ready;
+			}
+		};
+
 		// =============================================================================
 		// PROCESS UTILITIES
 		// =============================================================================
@@ -390,6 +470,14 @@ namespace utils
 			both
 		};
 
+		// fast launches through posix_spawn (vfork semantics, no page-table
+		// copy of the parent); fork_exec forces the classic fork path.
+		enum class spawn_mode_t : std::uint8_t
+		{
+			fast,
+			fork_exec
+		};
+
 		struct termination_request_t
 		{
 			std::atomic<bool> requested{false};
@@ -400,6 +488,16 @@ namespace utils
 
 		using output_callback_t = std::function<auto(const std::string&)->void>;
 
+		// Receives ownership of a pooled buffer holding p_size bytes of child
+		// stdout; return it with recycle_buffer() when done.
+		using chunk_callback_t = std::function<auto(std::unique_ptr<process_detail::data_t>, std::size_t)->void>;
+
+		// Receives a batch of newline-framed lines (without the terminator).
+		// The spans point into pooled buffers and are only valid for the
+		// duration of the call.
+		using line_batch_t	  = std::vector<process_detail::span<const char>>;
+		using line_callback_t = std::function<auto(const line_batch_t&)->void>;
+
 	private:
 		// =============================================================================
 		// PRIVATE MEMBER VARIABLES
@@ -421,6 +519,10 @@ namespace utils
 		std::chrono::milliseconds m_graceful_termination_timeout;
 		output_callback_t m_stdout_callback;
 		output_callback_t m_stderr_callback;
+		chunk_callback_t m_stdout_chunk_callback;
+		line_callback_t m_stdout_line_callback;
+		std::string m_line_carry;
+		std::int32_t m_stdout_splice_fd = -1;
 		bool m_capture_output = true;
 
 		std::string m_stdin_file_path;
@@ -428,6 +530,7 @@ namespace utils
 		std::string m_stderr_file_path;
 		redirect_mode_t m_stdout_redirect_mode = redirect_mode_t::memory;
 		redirect_mode_t m_stderr_redirect_mode = redirect_mode_t::memory;
+		spawn_mode_t m_spawn_mode			   = spawn_mode_t::fast;
 		bool m_stdin_from_file				   = false;
 
 		std::unique_ptr<std::mutex> m_pid_mutex;
@@ -548,12 +651,17 @@ namespace utils
 			  m_graceful_termination_timeout(p_other.m_graceful_termination_timeout),
 			  m_stdout_callback(std::move(p_other.m_stdout_callback)),
 			  m_stderr_callback(std::move(p_other.m_stderr_callback)),
+			  m_stdout_chunk_callback(std::move(p_other.m_stdout_chunk_callback)),
+			  m_stdout_line_callback(std::move(p_other.m_stdout_line_callback)),
+			  m_line_carry(std::move(p_other.m_line_carry)),
+			  m_stdout_splice_fd(p_other.m_stdout_splice_fd),
 			  m_capture_output(p_other.m_capture_output),
 			  m_stdin_file_path(std::move(p_other.m_stdin_file_path)),
 			  m_stdout_file_path(std::move(p_other.m_stdout_file_path)),
 			  m_stderr_file_path(std::move(p_other.m_stderr_file_path)),
 			  m_stdout_redirect_mode(p_other.m_stdout_redirect_mode),
 			  m_stderr_redirect_mode(p_other.m_stderr_redirect_mode),
+			  m_spawn_mode(p_other.m_spawn_mode),
 			  m_stdin_from_file(p_other.m_stdin_from_file),
 			  m_pid_mutex(std::move(p_other.m_pid_mutex)),
 			  m_pid_condition(std::move(p_other.m_pid_condition)),
@@ -575,6 +683,8 @@ namespace utils
 			p_other.m_capture_output			   = true;
 			p_other.m_stdout_redirect_mode		   = redirect_mode_t::memory;
 			p_other.m_stderr_redirect_mode		   = redirect_mode_t::memory;
+			p_other.m_spawn_mode				   = spawn_mode_t::fast;
+			p_other.m_stdout_splice_fd			   = -1;
 			p_other.m_stdin_from_file			   = false;
 			p_other.m_pid_ready.store(false);
 			p_other.m_termination_request.requested.store(false);
@@ -607,12 +717,17 @@ namespace utils
 				m_graceful_termination_timeout = p_other.m_graceful_termination_timeout;
 				m_stdout_callback			   = std::move(p_other.m_stdout_callback);
 				m_stderr_callback			   = std::move(p_other.m_stderr_callback);
+				m_stdout_chunk_callback		   = std::move(p_other.m_stdout_chunk_callback);
+				m_stdout_line_callback		   = std::move(p_other.m_stdout_line_callback);
+				m_line_carry				   = std::move(p_other.m_line_carry);
+				m_stdout_splice_fd			   = p_other.m_stdout_splice_fd;
 				m_capture_output			   = p_other.m_capture_output;
 				m_stdin_file_path			   = std::move(p_other.m_stdin_file_path);
 				m_stdout_file_path			   = std::move(p_other.m_stdout_file_path);
 				m_stderr_file_path			   = std::move(p_other.m_stderr_file_path);
 				m_stdout_redirect_mode		   = p_other.m_stdout_redirect_mode;
 				m_stderr_redirect_mode		   = p_other.m_stderr_redirect_mode;
+				m_spawn_mode				   = p_other.m_spawn_mode;
 				m_stdin_from_file			   = p_other.m_stdin_from_file;
 				m_pid_mutex					   = std::move(p_other.m_pid_mutex);
 				m_pid_condition				   = std::move(p_other.m_pid_condition);
@@ -634,6 +749,8 @@ namespace utils
 				p_other.m_capture_output			   = true;
 				p_other.m_stdout_redirect_mode		   = redirect_mode_t::memory;
 				p_other.m_stderr_redirect_mode		   = redirect_mode_t::memory;
+				p_other.m_spawn_mode				   = spawn_mode_t::fast;
+				p_other.m_stdout_splice_fd			   = -1;
 				p_other.m_stdin_from_file			   = false;
 				p_other.m_pid_ready.store(false);
 				p_other.m_termination_request.requested.store(false);
@@ -720,6 +837,30 @@ namespace utils
 
 		auto set_capture_output(bool p_capture) -> void { m_capture_output = p_capture; }
 
+		auto set_spawn_mode(spawn_mode_t p_mode) -> void { m_spawn_mode = p_mode; }
+
+		auto get_spawn_mode() const -> spawn_mode_t { return m_spawn_mode; }
+
+		// Splices child stdout straight into p_fd (file, socket, another pipe)
+		// without lifting the data into user space. Disables memory capture of
+		// stdout. The fd stays owned by the caller.
+		auto set_stdout_splice_fd(std::int32_t p_fd) -> void { m_stdout_splice_fd = p_fd; }
+
+		// Hands child stdout to p_callback as pooled fixed buffers filled via
+		// readv, with no re-concatenation into a string. Disables memory capture
+		// of stdout.
+		auto set_stdout_chunk_callback(chunk_callback_t p_callback) -> void { m_stdout_chunk_callback = std::move(p_callback); }
+
+		// Returns a buffer received through chunk_callback_t to the pool.
+		static auto recycle_buffer(std::unique_ptr<process_detail::data_t> p_buffer) -> void
+		{
+			process_detail::buffer_pool::instance().release(std::move(p_buffer));
+		}
+
+		// Delivers child stdout as batches of complete lines, each incoming
+		// chunk scanned once with mem_find. Disables memory capture of stdout.
+		auto set_stdout_line_callback(line_callback_t p_callback) -> void { m_stdout_line_callback = std::move(p_callback); }
+
 		auto set_stdout_callback(output_callback_t p_callback) -> void { m_stdout_callback = std::move(p_callback); }
 
 		auto set_stderr_callback(output_callback_t p_callback) -> void { m_stderr_callback = std::move(p_callback); }
@@ -1031,19 +1172,28 @@ namespace utils
 				return;
 			}
 
-			const pid_t child_pid = fork();
-
-			if (child_pid == -1)
+			pid_t child_pid = -1;
+			if (m_spawn_mode == spawn_mode_t::fast)
 			{
-				set_error(error_code_t::fork_failed);
-				m_status.store(status_t::error);
-				return;
+				child_pid = spawn_fast(p_command, pipe_setup_result);
 			}
 
-			if (child_pid == 0)
+			if (child_pid == -1)
 			{
-				setup_child_process(p_command, pipe_setup_result);
-				_exit(process_consts::k_exec_error_code);
+				child_pid = fork();
+
+				if (child_pid == -1)
+				{
+					set_error(error_code_t::fork_failed);
+					m_status.store(status_t::error);
+					return;
+				}
+
+				if (child_pid == 0)
+				{
+					setup_child_process(p_command, pipe_setup_result);
+					_exit(process_consts::k_exec_error_code);
+				}
 			}
 
 			m_pid.store(child_pid);
@@ -1096,9 +1246,119 @@ namespace utils
 			return result;
 		}
 
+		// Launches through posix_spawn so glibc can use vfork/CLONE_VM semantics
+		// and skip copying the parent's page tables — the dominant spawn cost for
+		// large parents. Returns -1 when the configuration needs the fork path
+		// (working directory on libcs without addchdir_np, or spawn failure).
+		auto spawn_fast(const std::string& p_command, pipe_setup_t& p_pipes) -> pid_t
+		{
+	#if !UTILS_PROCESS_HAS_SPAWN_CHDIR
+			if (!m_working_directory.empty())
+			{
+				return -1;
+			}
+	#endif
+
+			posix_spawn_file_actions_t actions;
+			if (posix_spawn_file_actions_init(&actions) != 0)
+			{
+				return -1;
+			}
+
+			posix_spawnattr_t attributes;
+			if (posix_spawnattr_init(&attributes) != 0)
+			{
+				posix_spawn_file_actions_destroy(&actions);
+				return -1;
+			}
+
+			std::int32_t setup_rc = 0;
+
+			// Drop the parent's pipe ends in the child
+			if (p_pipes.need_stdout)
+			{
+				setup_rc |= posix_spawn_file_actions_addclose(&actions, p_pipes.stdout_pipe.read_fd());
+			}
+			if (p_pipes.need_stderr)
+			{
+				setup_rc |= posix_spawn_file_actions_addclose(&actions, p_pipes.stderr_pipe.read_fd());
+			}
+			if (p_pipes.need_stdin)
+			{
+				setup_rc |= posix_spawn_file_actions_addclose(&actions, p_pipes.stdin_pipe.write_fd());
+			}
+
+			// Wire stdio to pipes or files, mirroring setup_child_io
+			if (m_stdin_from_file && !m_stdin_file_path.empty())
+			{
+				setup_rc |= posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, m_stdin_file_path.c_str(), O_RDONLY, 0);
+			}
+			else if (p_pipes.need_stdin)
+			{
+				setup_rc |= posix_spawn_file_actions_adddup2(&actions, p_pipes.stdin_pipe.read_fd(), STDIN_FILENO);
+			}
+
+			if (m_stdout_redirect_mode == redirect_mode_t::file && !m_stdout_file_path.empty())
+			{
+				setup_rc |= posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, m_stdout_file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+															 process_consts::k_file_permissions);
+			}
+			else if (p_pipes.need_stdout)
+			{
+				setup_rc |= posix_spawn_file_actions_adddup2(&actions, p_pipes.stdout_pipe.write_fd(), STDOUT_FILENO);
+			}
+
+			if (m_stderr_redirect_mode == redirect_mode_t::file && !m_stderr_file_path.empty())
+			{
+				setup_rc |= posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, m_stderr_file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+															 process_consts::k_file_permissions);
+			}
+			else if (p_pipes.need_stderr)
+			{
+				setup_rc |= posix_spawn_file_actions_adddup2(&actions, p_pipes.stderr_pipe.write_fd(), STDERR_FILENO);
+			}
+
+	#if UTILS_PROCESS_HAS_SPAWN_CHDIR
+			if (!m_working_directory.empty())
+			{
+				setup_rc |= posix_spawn_file_actions_addchdir_np(&actions, m_working_directory.c_str());
+			}
+	#endif
+
+			short spawn_flags = POSIX_SPAWN_SETPGROUP;
+	#if defined(POSIX_SPAWN_USEVFORK)
+			spawn_flags = static_cast<short>(spawn_flags | POSIX_SPAWN_USEVFORK);
+	#endif
+			setup_rc |= posix_spawnattr_setflags(&attributes, spawn_flags);
+			setup_rc |= posix_spawnattr_setpgroup(&attributes, 0);
+
+			pid_t child_pid = -1;
+			if (setup_rc == 0)
+			{
+				static thread_local std::array<char, 3> shell_name = {'s', 'h', '\0'};
+				static thread_local std::array<char, 3> dash_c_arg = {'-', 'c', '\0'};
+				std::vector<char> cmd_vector(p_command.begin(), p_command.end());
+				cmd_vector.push_back('\0');
+				std::array<char*, 4> argv = {shell_name.data(), dash_c_arg.data(), cmd_vector.data(), nullptr};
+
+				std::vector<char*> environ_copy;
+				std::vector<char*> new_environ;
+				create_environment_variables(environ_copy, new_environ);
+
+				setup_rc = posix_spawn(&child_pid, "/bin/sh", &actions, &attributes, argv.data(), environ_copy.data());
+
+				cleanup_environment_variables(new_environ);
+			}
+
+			posix_spawn_file_actions_destroy(&actions);
+			posix_spawnattr_destroy(&attributes);
+			return (setup_rc == 0) ? child_pid : -1;
+		}
+
 		auto should_use_stdout_pipe() const -> bool
 		{
-			return (m_stdout_redirect_mode == redirect_mode_t::memory || m_stdout_redirect_mode == redirect_mode_t::both || m_stdout_callback);
+			return (m_stdout_redirect_mode == redirect_mode_t::memory || m_stdout_redirect_mode == redirect_mode_t::both || m_stdout_callback ||
+					m_stdout_chunk_callback || m_stdout_line_callback || m_stdout_splice_fd != -1);
 		}
 
 		auto should_use_stderr_pipe() const -> bool
@@ -1358,6 +1618,259 @@ namespace utils
 		}
 
 		auto run_main_loop(pipe_setup_t& p_pipes) -> void
+		{
+			if (run_reactor_loop(p_pipes))
+			{
+				return;
+			}
+			run_select_loop(p_pipes);
+		}
+
+		// Blocks in epoll_wait until pipe data or hangup instead of polling on a
+		// timeout, so output is dispatched as soon as the child writes it.
+		// Returns false if the reactor could not be set up; run_select_loop is
+		// the fallback.
+		auto run_reactor_loop(pipe_setup_t& p_pipes) -> bool
+		{
+			process_detail::epoll_reactor reactor;
+			if (!reactor.is_valid())
+			{
+				return false;
+			}
+
+			if (p_pipes.need_stdout)
+			{
+				if (!process_detail::process_utilities::set_fd_nonblocking(p_pipes.stdout_pipe.read_fd()) || !reactor.add(p_pipes.stdout_pipe.read_fd()))
+				{
+					return false;
+				}
+			}
+			if (p_pipes.need_stderr)
+			{
+				if (!process_detail::process_utilities::set_fd_nonblocking(p_pipes.stderr_pipe.read_fd()) || !reactor.add(p_pipes.stderr_pipe.read_fd()))
+				{
+					return false;
+				}
+			}
+
+			auto start_time				= std::chrono::steady_clock::now();
+			auto last_termination_check = start_time;
+			const std::int32_t wait_ms	= static_cast<std::int32_t>(process_consts::k_termination_check_ms.count());
+
+			while (true)
+			{
+				auto now = std::chrono::steady_clock::now();
+				if (now - last_termination_check >= process_consts::k_termination_check_ms)
+				{
+					if (handle_termination_request())
+					{
+						break;
+					}
+					last_termination_check = now;
+				}
+
+				if (check_timeout(start_time))
+				{
+					break;
+				}
+
+				std::array<struct epoll_event, process_consts::k_epoll_max_events> events{};
+				const std::int32_t ready = reactor.wait(events.data(), static_cast<std::int32_t>(events.size()), wait_ms);
+				for (std::int32_t idx_for = 0; idx_for < ready; ++idx_for)
+				{
+					const std::int32_t event_fd = events.at(static_cast<std::size_t>(idx_for)).data.fd;
+					if (p_pipes.need_stdout && event_fd == p_pipes.stdout_pipe.read_fd())
+					{
+						drain_pipe_fd(event_fd, true);
+					}
+					else if (p_pipes.need_stderr && event_fd == p_pipes.stderr_pipe.read_fd())
+					{
+						drain_pipe_fd(event_fd, false);
+					}
+				}
+
+				if (check_process_status())
+				{
+					read_remaining_pipe_data(p_pipes);
+					break;
+				}
+			}
+			return true;
+		}
+
+		// Drains an edge-triggered non-blocking pipe until EAGAIN or EOF.
+		auto drain_pipe_fd(std::int32_t p_fd, bool p_is_stdout) -> void
+		{
+			while (true)
+			{
+				if (p_is_stdout)
+				{
+					if (consume_stdout_once(p_fd) <= 0)
+					{
+						break;
+					}
+					continue;
+				}
+
+				auto buffer				 = process_detail::buffer_pool::instance().acquire();
+				const ssize_t bytes_read = read(p_fd, buffer->data(), buffer->size() - 1);
+				if (bytes_read > 0)
+				{
+					process_stderr_data(*buffer, static_cast<std::size_t>(bytes_read));
+					process_detail::buffer_pool::instance().release(std::move(buffer));
+					continue;
+				}
+				process_detail::buffer_pool::instance().release(std::move(buffer));
+				break;
+			}
+		}
+
+		// One drain pass over the stdout pipe honoring the capture mode: splice
+		// into the destination fd, readv scatter into pooled buffers for the
+		// chunk callback, or the default pooled read into the memory buffer.
+		auto consume_stdout_once(std::int32_t p_fd) -> ssize_t
+		{
+			if (m_stdout_splice_fd != -1)
+			{
+				const ssize_t moved = splice(p_fd, nullptr, m_stdout_splice_fd, nullptr, process_consts::k_buffer_size * 4, SPLICE_F_MOVE);
+				if (moved != -1 || (errno != EINVAL && errno != ENOSYS))
+				{
+					return moved;
+				}
+
+				// Destination cannot take a splice from a pipe; copy through a
+				// pooled buffer instead
+				auto buffer				 = process_detail::buffer_pool::instance().acquire();
+				const ssize_t bytes_read = read(p_fd, buffer->data(), buffer->size());
+				if (bytes_read > 0)
+				{
+					write_fd_all(m_stdout_splice_fd, buffer->data(), static_cast<std::size_t>(bytes_read));
+				}
+				process_detail::buffer_pool::instance().release(std::move(buffer));
+				return bytes_read;
+			}
+
+			if (m_stdout_line_callback)
+			{
+				auto buffer				 = process_detail::buffer_pool::instance().acquire();
+				const ssize_t bytes_read = read(p_fd, buffer->data(), buffer->size());
+				if (bytes_read > 0)
+				{
+					decode_lines(buffer->data(), static_cast<std::size_t>(bytes_read));
+				}
+				else if (bytes_read == 0 && !m_line_carry.empty())
+				{
+					// EOF with an unterminated final line
+					const line_batch_t batch = {process_detail::make_span<const char>(m_line_carry.data(), m_line_carry.size())};
+					m_stdout_line_callback(batch);
+					m_line_carry.clear();
+				}
+				process_detail::buffer_pool::instance().release(std::move(buffer));
+				return bytes_read;
+			}
+
+			if (m_stdout_chunk_callback)
+			{
+				auto first	= process_detail::buffer_pool::instance().acquire();
+				auto second = process_detail::buffer_pool::instance().acquire();
+				std::array<struct iovec, 2> scatter = {{{first->data(), first->size()}, {second->data(), second->size()}}};
+				const ssize_t bytes_read			= readv(p_fd, scatter.data(), static_cast<std::int32_t>(scatter.size()));
+				if (bytes_read <= 0)
+				{
+					process_detail::buffer_pool::instance().release(std::move(first));
+					process_detail::buffer_pool::instance().release(std::move(second));
+					return bytes_read;
+				}
+
+				const std::size_t first_size = std::min(static_cast<std::size_t>(bytes_read), first->size());
+				m_stdout_chunk_callback(std::move(first), first_size);
+				if (static_cast<std::size_t>(bytes_read) > first_size)
+				{
+					m_stdout_chunk_callback(std::move(second), static_cast<std::size_t>(bytes_read) - first_size);
+				}
+				else
+				{
+					process_detail::buffer_pool::instance().release(std::move(second));
+				}
+				return bytes_read;
+			}
+
+			auto buffer				 = process_detail::buffer_pool::instance().acquire();
+			const ssize_t bytes_read = read(p_fd, buffer->data(), buffer->size() - 1);
+			if (bytes_read > 0)
+			{
+				process_stdout_data(*buffer, static_cast<std::size_t>(bytes_read));
+			}
+			process_detail::buffer_pool::instance().release(std::move(buffer));
+			return bytes_read;
+		}
+
+		// Scans one incoming chunk for newlines, delivering every complete line
+		// in a single callback batch. A trailing partial line is carried over to
+		// the next chunk.
+		auto decode_lines(const char* p_data, std::size_t p_size) -> void
+		{
+			line_batch_t batch;
+			std::size_t offset	  = 0;
+			const bool used_carry = !m_line_carry.empty();
+
+			if (used_carry)
+			{
+				const std::size_t newline_pos = utils::mem_find(p_data, p_size, '\n');
+				if (newline_pos == p_size)
+				{
+					m_line_carry.append(p_data, p_size);
+					return;
+				}
+				m_line_carry.append(p_data, newline_pos);
+				batch.push_back(process_detail::make_span<const char>(m_line_carry.data(), m_line_carry.size()));
+				offset = newline_pos + 1;
+			}
+
+			while (offset < p_size)
+			{
+				const std::size_t relative = utils::mem_find(p_data + offset, p_size - offset, '\n');
+				if (relative == p_size - offset)
+				{
+					break;
+				}
+				batch.push_back(process_detail::make_span<const char>(p_data + offset, relative));
+				offset += relative + 1;
+			}
+
+			if (!batch.empty())
+			{
+				m_stdout_line_callback(batch);
+			}
+			if (used_carry)
+			{
+				m_line_carry.clear();
+			}
+			if (offset < p_size)
+			{
+				m_line_carry.append(p_data + offset, p_size - offset);
+			}
+		}
+
+		static auto write_fd_all(std::int32_t p_fd, const char* p_data, std::size_t p_size) -> void
+		{
+			std::size_t total_written = 0;
+			while (total_written < p_size)
+			{
+				const ssize_t written = write(p_fd, p_data + total_written, p_size - total_written);
+				if (written == -1)
+				{
+					if (errno == EINTR)
+					{
+						continue;
+					}
+					break;
+				}
+				total_written += static_cast<std::size_t>(written);
+			}
+		}
+
+		auto run_select_loop(pipe_setup_t& p_pipes) -> void
 		{
 			auto start_time			 = std::chrono::steady_clock::now();
 			std::int32_t idle_cycles = 0;
@@ -1449,13 +1962,7 @@ namespace utils
 		{
 			if (p_pipes.need_stdout && FD_ISSET(p_pipes.stdout_pipe.read_fd(), &p_read_fds))
 			{
-				auto buffer				 = process_detail::buffer_pool::instance().acquire();
-				const ssize_t bytes_read = read(p_pipes.stdout_pipe.read_fd(), buffer->data(), buffer->size() - 1);
-				if (bytes_read > 0)
-				{
-					process_stdout_data(*buffer, static_cast<std::size_t>(bytes_read));
-				}
-				process_detail::buffer_pool::instance().release(std::move(buffer));
+				consume_stdout_once(p_pipes.stdout_pipe.read_fd());
 			}
 
 			if (p_pipes.need_stderr && FD_ISSET(p_pipes.stderr_pipe.read_fd(), &p_read_fds))
@@ -1478,14 +1985,10 @@ namespace utils
 
 				if (p_pipes.need_stdout)
 				{
-					auto buffer				 = process_detail::buffer_pool::instance().acquire();
-					const ssize_t bytes_read = read(p_pipes.stdout_pipe.read_fd(), buffer->data(), buffer->size() - 1);
-					if (bytes_read > 0)
+					if (consume_stdout_once(p_pipes.stdout_pipe.read_fd()) > 0)
 					{
-						process_stdout_data(*buffer, static_cast<std::size_t>(bytes_read));
 						read_data = true;
 					}
-					process_detail::buffer_pool::instance().release(std::move(buffer));
 				}
 
 				if (p_pipes.need_stderr)
@@ -1632,5 +2135,255 @@ namespace utils
 			}
 		}
 	};
+
+	// =============================================================================
+	// PROCESS POOL
+	// =============================================================================
+
+	// N warm worker processes launched once, so per-job cost is a pipe write and
+	// read instead of spawn+link+init. Protocol is line framed: each submitted
+	// payload is delivered as one line on a worker's stdin and the worker must
+	// answer with exactly one line on stdout. Idle workers park on the job queue;
+	// work goes to the first free one.
+	class process_pool
+	{
+	public:
+		using self_t = process_pool;
+
+	private:
+		struct worker_t
+		{
+			pid_t pid = -1;
+			process_detail::pipe_wrapper stdin_pipe;
+			process_detail::pipe_wrapper stdout_pipe;
+			std::string pending;	// over-read carried between results
+			std::thread runner;
+		};
+
+		struct job_t
+		{
+			std::string payload;
+			std::promise<std::string> result;
+		};
+
+		std::vector<std::unique_ptr<worker_t>> m_workers;
+		std::queue<job_t> m_jobs;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_stopping = false;
+
+	public:
+		~process_pool() { shutdown(); }
+
+		process_pool(const std::string& p_command, std::size_t p_worker_count)
+		{
+			for (std::size_t idx_for = 0; idx_for < p_worker_count; ++idx_for)
+			{
+				spawn_worker(p_command);
+			}
+		}
+
+		process_pool(const process_pool&)					 = delete;
+		auto operator=(const process_pool&) -> process_pool& = delete;
+		process_pool(process_pool&&)						 = delete;
+		auto operator=(process_pool&&) -> process_pool&		 = delete;
+
+		auto worker_count() const -> std::size_t { return m_workers.size(); }
+
+		// Queues a payload; the future resolves with the worker's reply line, or
+		// an empty string if the worker died.
+		auto submit(std::string p_payload) -> std::future<std::string>
+		{
+			job_t job;
+			job.payload			= std::move(p_payload);
+			auto future			= job.result.get_future();
+
+			{
+				const std::lock_guard<std::mutex> lock(m_mutex);
+				m_jobs.push(std::move(job));
+			}
+			m_condition.notify_one();
+			return future;
+		}
+
+		auto shutdown() -> void
+		{
+			{
+				const std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_stopping)
+				{
+					return;
+				}
+				m_stopping = true;
+			}
+			m_condition.notify_all();
+
+			// Runners first: closing stdin while a runner is inside
+			// write_payload would race the write against a recycled fd
+			for (auto& worker : m_workers)
+			{
+				if (worker->runner.joinable())
+				{
+					worker->runner.join();
+				}
+			}
+			for (auto& worker : m_workers)
+			{
+				// EOF on stdin lets a well-behaved worker drain and exit
+				worker->stdin_pipe.close_write();
+				if (worker->pid > 0)
+				{
+					std::int32_t status = 0;
+					if (waitpid(worker->pid, &status, WNOHANG) == 0)
+					{
+						kill(worker->pid, SIGTERM);
+						waitpid(worker->pid, &status, 0);
+					}
+				}
+			}
+
+			// Jobs nobody picked up (spawn failures, dead workers) must still
+			// resolve with the documented empty string, not broken_promise
+			std::queue<job_t> orphaned;
+			{
+				const std::lock_guard<std::mutex> lock(m_mutex);
+				orphaned.swap(m_jobs);
+			}
+			while (!orphaned.empty())
+			{
+				orphaned.front().result.set_value(std::string());
+				orphaned.pop();
+			}
+		}
+
+	private:
+		auto spawn_worker(const std::string& p_command) -> void
+		{
+			auto worker = std::unique_ptr<worker_t>(new worker_t());
+			if (!worker->stdin_pipe.is_valid() || !worker->stdout_pipe.is_valid())
+			{
+				return;
+			}
+
+			const pid_t child_pid = fork();
+			if (child_pid == -1)
+			{
+				return;
+			}
+
+			if (child_pid == 0)
+			{
+				if (dup2(worker->stdin_pipe.read_fd(), STDIN_FILENO) == -1 || dup2(worker->stdout_pipe.write_fd(), STDOUT_FILENO) == -1)
+				{
+					_exit(process_consts::k_exec_error_code);
+				}
+				worker->stdin_pipe.close_write();
+				worker->stdout_pipe.close_read();
+				execl("/bin/sh", "sh", "-c", p_command.c_str(), static_cast<char*>(nullptr));
+				_exit(process_consts::k_exec_error_code);
+			}
+
+			worker->pid = child_pid;
+			worker->stdin_pipe.close_read();
+			worker->stdout_pipe.close_write();
+			worker->runner = std::thread(&process_pool::worker_loop, this, worker.get());
+			m_workers.push_back(std::move(worker));
+		}
+
+		auto worker_loop(worker_t* p_worker) -> void
+		{
+			// A worker can die between jobs; the write must come back as EPIPE
+			// and resolve the promise empty instead of raising SIGPIPE
+			sigset_t pipe_set;
+			sigemptyset(&pipe_set);
+			sigaddset(&pipe_set, SIGPIPE);
+			pthread_sigmask(SIG_BLOCK, &pipe_set, nullptr);
+
+			while (true)
+			{
+				job_t job;
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_condition.wait(lock, [this]() -> bool { return m_stopping || !m_jobs.empty(); });
+					if (m_jobs.empty())
+					{
+						break;
+					}
+					job = std::move(m_jobs.front());
+					m_jobs.pop();
+				}
+
+				if (!write_payload(p_worker, job.payload))
+				{
+					job.result.set_value(std::string());
+					break;
+				}
+
+				std::string line;
+				const bool worker_alive = read_result_line(p_worker, line);
+				job.result.set_value(std::move(line));
+				if (!worker_alive)
+				{
+					break;
+				}
+			}
+		}
+
+		auto write_payload(worker_t* p_worker, const std::string& p_payload) -> bool
+		{
+			std::string framed = p_payload;
+			if (framed.empty() || framed.back() != '\n')
+			{
+				framed.push_back('\n');
+			}
+
+			std::size_t total_written = 0;
+			while (total_written < framed.size())
+			{
+				const ssize_t written = write(p_worker->stdin_pipe.write_fd(), framed.data() + total_written, framed.size() - total_written);
+				if (written == -1)
+				{
+					if (errno == EINTR)
+					{
+						continue;
+					}
+					return false;
+				}
+				total_written += static_cast<std::size_t>(written);
+			}
+			return true;
+		}
+
+		// Reads until one full line is available; extra bytes stay in
+		// worker_t::pending for the next job. Returns false on EOF.
+		auto read_result_line(worker_t* p_worker, std::string& p_line) -> bool
+		{
+			while (true)
+			{
+				const std::size_t newline_pos = p_worker->pending.find('\n');
+				if (newline_pos != std::string::npos)
+				{
+					p_line = p_worker->pending.substr(0, newline_pos);
+					p_worker->pending.erase(0, newline_pos + 1);
+					return true;
+				}
+
+				auto buffer				 = process_detail::buffer_pool::instance().acquire();
+				const ssize_t bytes_read = read(p_worker->stdout_pipe.read_fd(), buffer->data(), buffer->size());
+				if (bytes_read > 0)
+				{
+					p_worker->pending.append(buffer->data(), static_cast<std::size_t>(bytes_read));
+				}
+				process_detail::buffer_pool::instance().release(std::move(buffer));
+
+				if (bytes_read <= 0 && (bytes_read == 0 || errno != EINTR))
+				{
+					p_line = p_worker->pending;
+					p_worker->pending.clear();
+					return false;
+				}
+			}
+		}
+	};
 }	 // namespace utils
 #endif	  // PROCESS_HPP
\ No newline at end of file
@@ -3,7 +3,9 @@
 	#define TEST_INTERFACE_HPP
 
 	#include "test_utils_arg_parser.hpp"
+	#include "test_utils_containers.hpp"
 	#include "test_utils_filesystem.hpp"
+	#include "test_utils_loggers.hpp"
 	#include "test_utils_process.hpp"
 
 struct test_api
@@ -14,7 +16,9 @@ struct test_api
 	{
 		initialize();
 		test_utils_arg_parser::run_all_tests();
+		test_utils_containers::run_all_tests();
 		test_utils_filesystem::run_all_tests();
+		test_utils_loggers::run_all_tests();
 		test_utils_process::run_all_tests();
 	}
 };
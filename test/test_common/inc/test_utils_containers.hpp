@@ -0,0 +1,22 @@
+#pragma once
+#ifndef TEST_UTILS_CONTAINERS_HPP
+	#define TEST_UTILS_CONTAINERS_HPP
+
+	#include "flat_hash_map.hpp"
+	#include "small_vector.hpp"
+	#include "test_common.hpp"
+
+namespace test_utils_containers
+{
+	auto run_flat_hash_map_tests(test_common::test_runner& p_runner) -> void;
+	auto run_small_vector_tests(test_common::test_runner& p_runner) -> void;
+
+	static inline auto run_all_tests() -> void
+	{
+		test_common::test_runner runner("test_utils_containers", false);
+		run_flat_hash_map_tests(runner);
+		run_small_vector_tests(runner);
+	}
+}
+
+#endif // TEST_UTILS_CONTAINERS_HPP
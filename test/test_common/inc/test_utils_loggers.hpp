@@ -0,0 +1,19 @@
+#pragma once
+#ifndef TEST_UTILS_LOGGERS_HPP
+	#define TEST_UTILS_LOGGERS_HPP
+
+	#include "loggers.hpp"
+	#include "test_common.hpp"
+
+namespace test_utils_loggers
+{
+	auto run_binary_log_tests(test_common::test_runner& p_runner) -> void;
+
+	static inline auto run_all_tests() -> void
+	{
+		test_common::test_runner runner("test_utils_loggers", false);
+		run_binary_log_tests(runner);
+	}
+}
+
+#endif // TEST_UTILS_LOGGERS_HPP
@@ -7,10 +7,14 @@
 
 namespace test_utils_process
 {
+	using utils::process;
+
 	auto run_basic_process_tests(test_common::test_runner& p_runner) -> void;
 	auto run_sync_execution_tests(test_common::test_runner& p_runner) -> void;
 	auto run_async_execution_tests(test_common::test_runner& p_runner) -> void;
 	auto run_error_handling_tests(test_common::test_runner& p_runner) -> void;
+	auto run_streaming_output_tests(test_common::test_runner& p_runner) -> void;
+	auto run_spawn_mode_tests(test_common::test_runner& p_runner) -> void;
 
 	static inline auto run_all_tests() -> void
 	{
@@ -19,6 +23,8 @@ namespace test_utils_process
 		run_sync_execution_tests(runner);
 		run_async_execution_tests(runner);
 		run_error_handling_tests(runner);
+		run_streaming_output_tests(runner);
+		run_spawn_mode_tests(runner);
 	}
 }
 
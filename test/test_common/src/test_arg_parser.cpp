@@ -490,6 +490,170 @@ namespace test_utils_arg_parser
 		});
 	}
 
+	auto test_view_parser_values(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("View Parser Values", [&]()
+		{
+			utils::arg_view_parser parser;
+			parser.add_string("--name", "-n")
+				.add_int("--count", "-c")
+				.add_float("--rate", "-r")
+				.add_bool("--enable", "-e")
+				.add_flag("--verbose", "-v");
+
+			// Mix of --name=value and split-token values, long and short names
+			const char* argv[] = {"program", "--name=inline_value", "-c", "42", "--rate", "2.5", "--enable=yes", "-v"};
+			auto result = parser.parse(8, argv);
+
+			p_runner.assert_true(result.has_value());
+			p_runner.assert_true(parser.was_set("--name"));
+			p_runner.assert_equals(std::string(parser.get_string("--name")), std::string("inline_value"));
+			p_runner.assert_equals(parser.get_int("--count"), std::int64_t(42));
+			p_runner.assert_equals(parser.get_float("--rate"), 2.5);
+			p_runner.assert_true(parser.get_bool("--enable"));
+			p_runner.assert_true(parser.get_bool("--verbose"));
+		});
+	}
+
+	auto test_view_parser_defaults(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("View Parser Defaults", [&]()
+		{
+			utils::arg_view_parser parser;
+			parser.add_string("--name", "-n", "fallback")
+				.add_int("--count", "-c", 7)
+				.add_float("--rate", "-r", 1.5)
+				.add_bool("--enable", "-e", true);
+
+			const char* argv[] = {"program"};
+			auto result = parser.parse(1, argv);
+
+			p_runner.assert_true(result.has_value());
+			p_runner.assert_false(parser.was_set("--name"));
+			p_runner.assert_equals(parser.get_string("--name"), std::string_view("fallback"));
+			p_runner.assert_equals(parser.get_int("--count"), std::int64_t(7));
+			p_runner.assert_equals(parser.get_float("--rate"), 1.5);
+			p_runner.assert_true(parser.get_bool("--enable"));
+
+			// A later parse with values must not leak into a parse without them
+			const char* argv_set[] = {"program", "--count=99"};
+			p_runner.assert_true(parser.parse(2, argv_set).has_value());
+			p_runner.assert_equals(parser.get_int("--count"), std::int64_t(99));
+			p_runner.assert_true(parser.parse(1, argv).has_value());
+			p_runner.assert_equals(parser.get_int("--count"), std::int64_t(7));
+		});
+	}
+
+	auto test_view_parser_errors(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("View Parser Errors", [&]()
+		{
+			utils::arg_view_parser parser;
+			parser.add_string("--name", "-n")
+				.add_int("--count", "-c")
+				.add_float("--rate", "-r")
+				.add_bool("--enable", "-e")
+				.add_string("--required-opt", "", "", true);
+
+			const char* unknown[] = {"program", "--required-opt=x", "--bogus"};
+			auto result = parser.parse(3, unknown);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::unknown_argument);
+			p_runner.assert_equals(result.error().arg, std::string_view("--bogus"));
+
+			const char* missing_value[] = {"program", "--required-opt=x", "--name"};
+			result = parser.parse(3, missing_value);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::missing_value);
+
+			const char* bad_int[] = {"program", "--required-opt=x", "--count=abc"};
+			result = parser.parse(3, bad_int);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::invalid_integer);
+
+			const char* bad_float[] = {"program", "--required-opt=x", "--rate=fast"};
+			result = parser.parse(3, bad_float);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::invalid_float);
+
+			const char* bad_bool[] = {"program", "--required-opt=x", "--enable=maybe"};
+			result = parser.parse(3, bad_bool);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::invalid_boolean);
+
+			const char* missing_required[] = {"program", "--name=set"};
+			result = parser.parse(2, missing_required);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::missing_required);
+			p_runner.assert_equals(result.error().arg, std::string_view("--required-opt"));
+		});
+	}
+
+	auto test_static_parser_values(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("Static Parser Values", [&]()
+		{
+			static constexpr utils::arg_spec specs[] = {
+				utils::make_string_arg("--output", "-o", "out.txt"),
+				utils::make_int_arg("--jobs", "-j", 1),
+				utils::make_float_arg("--scale", "-s", 1.0),
+				utils::make_bool_arg("--strict", "-S"),
+				utils::make_flag_arg("--quiet", "-q"),
+			};
+			utils::static_arg_parser<5> parser(specs);
+
+			const char* argv[] = {"program", "--output=result.bin", "-j", "8", "--scale", "0.5", "--strict=true", "-q"};
+			auto result = parser.parse(8, argv);
+
+			p_runner.assert_true(result.has_value());
+			p_runner.assert_equals(parser.get_string("--output"), std::string_view("result.bin"));
+			p_runner.assert_equals(parser.get_int("--jobs"), std::int64_t(8));
+			p_runner.assert_equals(parser.get_float("--scale"), 0.5);
+			p_runner.assert_true(parser.get_bool("--strict"));
+			p_runner.assert_true(parser.get_bool("--quiet"));
+
+			// Defaults come back after a parse without the arguments
+			const char* bare[] = {"program"};
+			p_runner.assert_true(parser.parse(1, bare).has_value());
+			p_runner.assert_false(parser.was_set("--jobs"));
+			p_runner.assert_equals(parser.get_string("--output"), std::string_view("out.txt"));
+			p_runner.assert_equals(parser.get_int("--jobs"), std::int64_t(1));
+		});
+	}
+
+	auto test_static_parser_errors(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("Static Parser Errors", [&]()
+		{
+			static constexpr utils::arg_spec specs[] = {
+				utils::make_int_arg("--jobs", "-j", 1),
+				utils::make_string_arg("--input", "-i", "", true),
+			};
+			utils::static_arg_parser<2> parser(specs);
+
+			const char* unknown[] = {"program", "--input=a", "--bogus"};
+			auto result = parser.parse(3, unknown);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::unknown_argument);
+
+			const char* bad_int[] = {"program", "--input=a", "--jobs=many"};
+			result = parser.parse(3, bad_int);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::invalid_integer);
+
+			const char* missing_value[] = {"program", "--input"};
+			result = parser.parse(2, missing_value);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::missing_value);
+
+			const char* missing_required[] = {"program", "--jobs=4"};
+			result = parser.parse(2, missing_required);
+			p_runner.assert_false(result.has_value());
+			p_runner.assert_true(result.error().code == utils::view_parse_error::missing_required);
+			p_runner.assert_equals(result.error().arg, std::string_view("--input"));
+		});
+	}
+
 	auto run_all_tests() -> void
 	{
 		auto runner = test_common::create_test_runner("Argument Parser Tests", true);
@@ -520,5 +684,10 @@ namespace test_utils_arg_parser
 		test_get_set_args(*runner);
 		test_missing_value_for_argument(*runner);
 		test_binding_with_6_parameter_version(*runner);
+		test_view_parser_values(*runner);
+		test_view_parser_defaults(*runner);
+		test_view_parser_errors(*runner);
+		test_static_parser_values(*runner);
+		test_static_parser_errors(*runner);
 	}
 }	 // namespace test_utils_arg_parser
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "test_utils_containers.hpp"
+
+#include <string>
+#include <utility>
+
+namespace test_utils_containers
+{
+	auto run_flat_hash_map_tests(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("insert_and_find",
+							   [&]()
+							   {
+								   utils::flat_hash_map<int, int> map;
+								   p_runner.assert_true(map.empty());
+
+								   for (int idx_for = 0; idx_for < 100; ++idx_for)
+								   {
+									   map[idx_for] = idx_for * 3;
+								   }
+
+								   p_runner.assert_equals(map.size(), static_cast<std::size_t>(100));
+								   p_runner.assert_equals(map.at(42), 126);
+								   p_runner.assert_true(map.find(1000) == map.end());
+							   });
+
+		p_runner.run_test_case("erase_and_reuse",
+							   [&]()
+							   {
+								   utils::flat_hash_map<int, int> map;
+								   for (int idx_for = 0; idx_for < 100; ++idx_for)
+								   {
+									   map[idx_for] = idx_for;
+								   }
+
+								   for (int idx_for = 0; idx_for < 100; idx_for += 2)
+								   {
+									   p_runner.assert_equals(map.erase(idx_for), static_cast<std::size_t>(1));
+								   }
+
+								   p_runner.assert_equals(map.size(), static_cast<std::size_t>(50));
+								   p_runner.assert_false(map.contains(0));
+								   p_runner.assert_true(map.contains(1));
+
+								   // Erased keys insert again through the tombstones
+								   map[0] = 7;
+								   p_runner.assert_equals(map.at(0), 7);
+							   });
+
+		p_runner.run_test_case("heterogeneous_string_lookup",
+							   [&]()
+							   {
+								   utils::flat_hash_map<std::string, int> map;
+								   map["alpha"] = 1;
+								   map["beta"]	= 2;
+
+								   // const char* and string_view probe without building a std::string
+								   p_runner.assert_true(map.contains("alpha"));
+								   p_runner.assert_equals(map.at(std::string_view("beta")), 2);
+								   p_runner.assert_false(map.contains("gamma"));
+							   });
+
+		p_runner.run_test_case("iteration_visits_each_element_once",
+							   [&]()
+							   {
+								   utils::flat_hash_map<int, int> map;
+								   for (int idx_for = 0; idx_for < 50; ++idx_for)
+								   {
+									   map[idx_for] = 1;
+								   }
+
+								   std::size_t visited = 0;
+								   int key_sum		   = 0;
+								   for (auto& entry : map)
+								   {
+									   ++visited;
+									   key_sum += entry.first;
+								   }
+
+								   p_runner.assert_equals(visited, map.size());
+								   p_runner.assert_equals(key_sum, (49 * 50) / 2);
+							   });
+
+		p_runner.run_test_case("copy_and_move",
+							   [&]()
+							   {
+								   utils::flat_hash_map<std::string, int> map;
+								   map["one"] = 1;
+								   map["two"] = 2;
+
+								   utils::flat_hash_map<std::string, int> copy(map);
+								   copy["three"] = 3;
+								   p_runner.assert_equals(copy.size(), static_cast<std::size_t>(3));
+								   p_runner.assert_false(map.contains("three"));
+
+								   utils::flat_hash_map<std::string, int> moved(std::move(copy));
+								   p_runner.assert_equals(moved.at("three"), 3);
+								   p_runner.assert_true(copy.empty());
+							   });
+	}
+
+	auto run_small_vector_tests(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("inline_until_spill",
+							   [&]()
+							   {
+								   utils::small_vector<int, 4> vec;
+								   p_runner.assert_true(vec.is_inline());
+								   p_runner.assert_equals(vec.capacity(), static_cast<std::size_t>(4));
+
+								   for (int idx_for = 0; idx_for < 4; ++idx_for)
+								   {
+									   vec.push_back(idx_for);
+								   }
+								   p_runner.assert_true(vec.is_inline());
+
+								   vec.push_back(4);
+								   p_runner.assert_false(vec.is_inline());
+								   p_runner.assert_equals(vec.size(), static_cast<std::size_t>(5));
+
+								   for (int idx_for = 0; idx_for < 5; ++idx_for)
+								   {
+									   p_runner.assert_equals(vec[static_cast<std::size_t>(idx_for)], idx_for);
+								   }
+							   });
+
+		p_runner.run_test_case("stack_discipline",
+							   [&]()
+							   {
+								   utils::small_vector<std::string, 4> vec;
+								   vec.emplace_back("first");
+								   vec.emplace_back("second");
+								   p_runner.assert_equals(vec.back(), std::string("second"));
+
+								   vec.pop_back();
+								   p_runner.assert_equals(vec.back(), std::string("first"));
+								   vec.clear();
+								   p_runner.assert_true(vec.empty());
+							   });
+
+		p_runner.run_test_case("assign_resize_erase",
+							   [&]()
+							   {
+								   const int source[] = {10, 20, 30, 40, 50};
+								   utils::small_vector<int, 2> vec;
+								   vec.assign(source, source + 5);
+								   p_runner.assert_equals(vec.size(), static_cast<std::size_t>(5));
+
+								   vec.erase(vec.begin() + 1);
+								   p_runner.assert_equals(vec[1], 30);
+
+								   vec.resize(2);
+								   p_runner.assert_equals(vec.size(), static_cast<std::size_t>(2));
+								   vec.resize(4);
+								   p_runner.assert_equals(vec[3], 0);
+							   });
+
+		p_runner.run_test_case("move_steals_spilled_buffer",
+							   [&]()
+							   {
+								   utils::small_vector<std::string, 2> src;
+								   for (int idx_for = 0; idx_for < 8; ++idx_for)
+								   {
+									   src.emplace_back(std::string(8, static_cast<char>('a' + idx_for)));
+								   }
+								   p_runner.assert_false(src.is_inline());
+
+								   utils::small_vector<std::string, 2> dst(std::move(src));
+								   p_runner.assert_equals(dst.size(), static_cast<std::size_t>(8));
+								   p_runner.assert_true(src.empty());
+								   p_runner.assert_true(src.is_inline());
+								   p_runner.assert_equals(dst[7], std::string(8, 'h'));
+							   });
+
+		p_runner.run_test_case("copy_is_deep",
+							   [&]()
+							   {
+								   utils::small_vector<int, 4> a;
+								   for (int idx_for = 0; idx_for < 6; ++idx_for)
+								   {
+									   a.push_back(idx_for);
+								   }
+
+								   utils::small_vector<int, 4> b(a);
+								   b[0] = 99;
+								   p_runner.assert_equals(a[0], 0);
+								   p_runner.assert_equals(b.size(), a.size());
+							   });
+	}
+}
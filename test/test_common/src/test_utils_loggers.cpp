@@ -0,0 +1,124 @@
+#include "test_utils_loggers.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace test_utils_loggers
+{
+	namespace
+	{
+		auto read_file_bytes(const std::string& p_path) -> std::vector<char>
+		{
+			std::ifstream input(p_path, std::ios::binary);
+			return std::vector<char>((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+		}
+
+		auto write_file_bytes(const std::string& p_path, const std::vector<char>& p_bytes) -> void
+		{
+			std::ofstream output(p_path, std::ios::binary | std::ios::trunc);
+			output.write(p_bytes.data(), static_cast<std::streamsize>(p_bytes.size()));
+		}
+	}	 // namespace
+
+	auto run_binary_log_tests(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("encode_decode_round_trip",
+							   [&]()
+							   {
+								   const std::string path = "/tmp/test_binary_log_roundtrip.blog";
+								   {
+									   utils::binary_log log(path);
+									   p_runner.assert_true(log.is_open());
+									   p_runner.assert_true(log.write("plain message").has_value());
+									   p_runner.assert_true(log.write("count={} ratio={}", 42, 2.5).has_value());
+									   p_runner.assert_true(log.write("name={}", std::string("payload")).has_value());
+									   p_runner.assert_true(log.write("literal={}", "c-string").has_value());
+
+									   // Same site again: the registration record must
+									   // not repeat and the id must still resolve
+									   p_runner.assert_true(log.write("count={} ratio={}", 7, 0.5).has_value());
+								   }
+
+								   utils::binary_log_decoder decoder(path);
+								   p_runner.assert_true(decoder.is_open());
+								   const std::vector<std::string> lines = decoder.decode_all();
+								   p_runner.assert_equals(lines.size(), std::size_t(5));
+								   p_runner.assert_equals(lines[0], std::string("plain message"));
+								   p_runner.assert_equals(lines[1], std::string("count=42 ratio=2.5"));
+								   p_runner.assert_equals(lines[2], std::string("name=payload"));
+								   p_runner.assert_equals(lines[3], std::string("literal=c-string"));
+								   p_runner.assert_equals(lines[4], std::string("count=7 ratio=0.5"));
+								   p_runner.assert_true(decoder.last_timestamp_ns() > 0);
+
+								   std::remove(path.c_str());
+							   });
+
+		p_runner.run_test_case("truncated_tail_reported_not_crashed",
+							   [&]()
+							   {
+								   const std::string path = "/tmp/test_binary_log_truncated.blog";
+								   {
+									   utils::binary_log log(path);
+									   p_runner.assert_true(log.write("first={}", 1).has_value());
+									   p_runner.assert_true(log.write("second={}", std::string("whole string")).has_value());
+								   }
+
+								   // Chop into the last record's payload
+								   std::vector<char> bytes = read_file_bytes(path);
+								   bytes.resize(bytes.size() - 5);
+								   write_file_bytes(path, bytes);
+
+								   utils::binary_log_decoder decoder(path);
+								   p_runner.assert_true(decoder.is_open());
+
+								   auto first = decoder.decode_next();
+								   p_runner.assert_true(first.has_value());
+								   p_runner.assert_equals(first.value(), std::string("first=1"));
+
+								   auto second = decoder.decode_next();
+								   p_runner.assert_false(second.has_value());
+								   p_runner.assert_true(second.error() == utils::binary_log_decoder::decode_error_t::truncated_record);
+
+								   std::remove(path.c_str());
+							   });
+
+		p_runner.run_test_case("unregistered_id_rejected",
+							   [&]()
+							   {
+								   const std::string path = "/tmp/test_binary_log_unregistered.blog";
+
+								   // Hand-built stream: valid header, then a message
+								   // record whose id never had a registration
+								   std::vector<char> bytes;
+								   const std::uint32_t magic	  = utils::binary_log::k_magic;
+								   const std::uint16_t version	  = utils::binary_log::k_version;
+								   const std::uint8_t kind		  = 1;	  // message
+								   const std::uint32_t id		  = 5;
+								   const std::uint64_t timestamp  = 0;
+								   const std::uint32_t payload	  = 0;
+								   const auto append			  = [&bytes](const void* p_data, std::size_t p_size)
+								   {
+									   const char* raw = static_cast<const char*>(p_data);
+									   bytes.insert(bytes.end(), raw, raw + p_size);
+								   };
+								   append(&magic, sizeof(magic));
+								   append(&version, sizeof(version));
+								   append(&kind, sizeof(kind));
+								   append(&id, sizeof(id));
+								   append(&timestamp, sizeof(timestamp));
+								   append(&payload, sizeof(payload));
+								   write_file_bytes(path, bytes);
+
+								   utils::binary_log_decoder decoder(path);
+								   p_runner.assert_true(decoder.is_open());
+								   auto result = decoder.decode_next();
+								   p_runner.assert_false(result.has_value());
+								   p_runner.assert_true(result.error() == utils::binary_log_decoder::decode_error_t::unregistered_id);
+
+								   std::remove(path.c_str());
+							   });
+	}
+}
@@ -1,7 +1,10 @@
 #include "test_utils_process.hpp"
 
 #include <chrono>
+#include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace test_utils_process
 {
@@ -188,4 +191,110 @@ namespace test_utils_process
 								   p_runner.assert_false(p.get_output().empty());
 							   });
 	}
+
+	auto run_streaming_output_tests(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("line_callback_across_chunk_boundaries",
+							   [&]()
+							   {
+								   process p;
+								   std::vector<std::string> lines;
+								   p.set_stdout_line_callback(
+									   [&lines](const process::line_batch_t& p_batch)
+									   {
+										   for (const auto& entry : p_batch)
+										   {
+											   lines.emplace_back(entry.data(), entry.size());
+										   }
+									   });
+
+								   // The sleeps force separate pipe reads, so both lines
+								   // straddle a chunk boundary and exercise the carry path
+								   p.execute("printf 'first ha'; sleep 0.05; printf 'lf\\nsecond\\nthird sta'; sleep 0.05; printf 'rt\\n'");
+								   p_runner.assert_equals(p.get_return_code(), 0);
+								   p_runner.assert_equals(lines.size(), std::size_t(3));
+								   p_runner.assert_equals(lines[0], std::string("first half"));
+								   p_runner.assert_equals(lines[1], std::string("second"));
+								   p_runner.assert_equals(lines[2], std::string("third start"));
+							   });
+
+		p_runner.run_test_case("line_callback_eof_without_terminator",
+							   [&]()
+							   {
+								   process p;
+								   std::vector<std::string> lines;
+								   p.set_stdout_line_callback(
+									   [&lines](const process::line_batch_t& p_batch)
+									   {
+										   for (const auto& entry : p_batch)
+										   {
+											   lines.emplace_back(entry.data(), entry.size());
+										   }
+									   });
+
+								   p.execute("printf 'closed\\nno terminator'");
+								   p_runner.assert_equals(p.get_return_code(), 0);
+								   p_runner.assert_equals(lines.size(), std::size_t(2));
+								   p_runner.assert_equals(lines[0], std::string("closed"));
+								   p_runner.assert_equals(lines[1], std::string("no terminator"));
+							   });
+
+		p_runner.run_test_case("chunk_callback_reassembles_output",
+							   [&]()
+							   {
+								   process p;
+								   std::string reassembled;
+								   p.set_stdout_chunk_callback(
+									   [&reassembled](std::unique_ptr<utils::process_detail::data_t> p_buffer, std::size_t p_size)
+									   {
+										   reassembled.append(p_buffer->data(), p_size);
+										   process::recycle_buffer(std::move(p_buffer));
+									   });
+
+								   // Larger than one pooled buffer so the readv scatter
+								   // splits across the first/second buffer
+								   p.execute("head -c 20000 /dev/zero | tr '\\0' 'x'");
+								   p_runner.assert_equals(p.get_return_code(), 0);
+								   p_runner.assert_equals(reassembled.size(), std::size_t(20000));
+								   p_runner.assert_equals(reassembled, std::string(20000, 'x'));
+							   });
+	}
+
+	auto run_spawn_mode_tests(test_common::test_runner& p_runner) -> void
+	{
+		p_runner.run_test_case("spawn_fast_matches_fork_exec",
+							   [&]()
+							   {
+								   const std::string command = "echo equivalence; echo stream two; exit 7";
+
+								   process fast;
+								   fast.set_spawn_mode(process::spawn_mode_t::fast);
+								   fast.execute(command);
+
+								   process classic;
+								   classic.set_spawn_mode(process::spawn_mode_t::fork_exec);
+								   classic.execute(command);
+
+								   p_runner.assert_equals(fast.get_return_code(), 7);
+								   p_runner.assert_equals(classic.get_return_code(), 7);
+								   p_runner.assert_equals(fast.get_stdout(), classic.get_stdout());
+								   p_runner.assert_equals(fast.get_stdout(), std::string("equivalence\nstream two"));
+							   });
+
+		p_runner.run_test_case("spawn_fast_working_directory",
+							   [&]()
+							   {
+								   process fast;
+								   fast.set_spawn_mode(process::spawn_mode_t::fast);
+								   fast.set_working_directory("/tmp");
+								   fast.execute("pwd");
+
+								   process classic;
+								   classic.set_spawn_mode(process::spawn_mode_t::fork_exec);
+								   classic.set_working_directory("/tmp");
+								   classic.execute("pwd");
+
+								   p_runner.assert_equals(fast.get_stdout(), classic.get_stdout());
+							   });
+	}
 }
\ No newline at end of file